@@ -0,0 +1,52 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/CompiledObjectContainer.h"
+
+UObjectContainer* FCompiledObjectContainer::Build(UObject* Outer) const
+{
+    UObjectContainer* Container = Outer ? NewObject<UObjectContainer>(Outer) : NewObject<UObjectContainer>();
+    Container->OuterForNewObjects = OuterForNewObjects ? OuterForNewObjects.Get() : Container->GetOuter();
+
+    AddRegistrationsToContainer(Container);
+
+    return Container;
+}
+
+UObjectContainer* FCompiledObjectContainer::BuildNested(UObjectContainer& Parent) const
+{
+    UObjectContainer* Container = NewObject<UObjectContainer>(&Parent);
+    Container->OuterForNewObjects = OuterForNewObjects ? OuterForNewObjects.Get() : Parent.OuterForNewObjects.Get();
+    Container->ParentContainer = &Parent;
+
+    AddRegistrationsToContainer(Container);
+
+    return Container;
+}
+
+void FCompiledObjectContainer::AddRegistrationsToContainer(UObjectContainer* Container) const
+{
+    // table does not contain registrations of a container itself, they depend on parent and are added separately
+    Container->CopyRegistrations(Registrations, SoftEffectiveClasses, nullptr);
+    Container->AddSelfRegistrations();
+    Container->AutoCreatedTypes = AutoCreatedTypes;
+
+    Container->FinalizeCreation();
+}
+
+void FCompiledObjectContainer::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    for (auto& Resolvers : Registrations)
+    {
+        for (UObjectContainer::FResolver& Resolver : Resolvers.Value)
+        {
+            Resolver.LifetimeHandler->AddReferencedObjects(Collector);
+        }
+    }
+
+    Collector.AddReferencedObject(OuterForNewObjects);
+}
+
+FString FCompiledObjectContainer::GetReferencerName() const
+{
+    return TEXT("FCompiledObjectContainer");
+}
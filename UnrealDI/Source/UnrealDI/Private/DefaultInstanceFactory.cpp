@@ -3,10 +3,23 @@
 #include "DI/Impl/DefaultInstanceFactory.h"
 
 #include "GameFramework/Actor.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "AI/NavigationSystemBase.h"
 #include "Blueprint/UserWidget.h"
 #include "Misc/EngineVersionComparison.h"
 
 UObject* UDefaultInstanceFactory::Create(UObject* Outer, UClass* EffectiveClass) const
+{
+    return CreateWithParams(Outer, EffectiveClass, FObjectCreationParams());
+}
+
+void UDefaultInstanceFactory::FinalizeCreation(UObject* Object) const
+{
+    FinalizeCreationWithParams(Object, FObjectCreationParams());
+}
+
+UObject* UDefaultInstanceFactory::CreateWithParams(UObject* Outer, UClass* EffectiveClass, const FObjectCreationParams& Params) const
 {
     UWorld* World = Outer->GetWorld();
 
@@ -14,7 +27,14 @@ UObject* UDefaultInstanceFactory::Create(UObject* Outer, UClass* EffectiveClass)
     {
         checkf(World != nullptr, TEXT("Cannot retrieve World from container. Make sure you provided valid Outer to FObjectContainerBuilder::Build"));
 
-        return World->SpawnActorDeferred<AActor>(EffectiveClass, FTransform::Identity);
+        FActorSpawnParameters SpawnParameters;
+        SpawnParameters.Owner = Params.Owner;
+        SpawnParameters.Instigator = Params.Instigator;
+        SpawnParameters.SpawnCollisionHandlingOverride = Params.CollisionHandlingOverride;
+        SpawnParameters.OverrideLevel = Cast<ULevel>(Outer);
+        SpawnParameters.bDeferConstruction = true;
+
+        return World->SpawnActor(EffectiveClass, &Params.SpawnTransform, SpawnParameters);
     }
 
     if (EffectiveClass->IsChildOf<UUserWidget>())
@@ -24,6 +44,12 @@ UObject* UDefaultInstanceFactory::Create(UObject* Outer, UClass* EffectiveClass)
         return CreateWidget<UUserWidget>(World, EffectiveClass);
     }
 
+    if (Params.NamingPolicy == EObjectNamingPolicy::Unique)
+    {
+        // let NewObject pick unique name without searching for object with stable one
+        return NewObject<UObject>(Outer, EffectiveClass);
+    }
+
     // try to create objects with stable names if possible
     FName NewObjectName = EffectiveClass->GetFName();
 
@@ -44,10 +70,34 @@ UObject* UDefaultInstanceFactory::Create(UObject* Outer, UClass* EffectiveClass)
     return NewObject<UObject>(Outer, EffectiveClass, NewObjectName);
 }
 
-void UDefaultInstanceFactory::FinalizeCreation(UObject* Object) const
+void UDefaultInstanceFactory::FinalizeCreationWithParams(UObject* Object, const FObjectCreationParams& Params) const
 {
     if (AActor* Actor = Cast<AActor>(Object))
     {
-        Actor->FinishSpawning(FTransform::Identity);
+        Actor->FinishSpawning(Params.SpawnTransform);
     }
 }
+
+void UDefaultInstanceFactory::FinalizeCreationMany(TArrayView<UObject* const> Objects, const FObjectCreationParams& Params) const
+{
+    if (Objects.Num() == 0)
+    {
+        return;
+    }
+
+    // all objects in a batch have the same class, so it is enough to check the first one
+    if (AActor* FirstActor = Cast<AActor>(Objects[0]))
+    {
+        // defer navigation octree updates until all actors finished spawning
+        FNavigationLockContext NavigationLock(FirstActor->GetWorld(), ENavigationLockReason::Unknown);
+
+        for (UObject* Object : Objects)
+        {
+            StaticCast<AActor*>(Object)->FinishSpawning(Params.SpawnTransform);
+        }
+
+        return;
+    }
+
+    IInstanceFactory::FinalizeCreationMany(Objects, Params);
+}
@@ -0,0 +1,96 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/Impl/DeferredInjectionQueue.h"
+#include "DI/InjectOnConstruction.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace UnrealDI_Impl
+{
+    static float DeferredInjectionBudgetMs = 1.0f;
+    static FAutoConsoleVariableRef CVarDeferredInjectionBudgetMs(
+        TEXT("UnrealDI.DeferredInjectionBudgetMs"),
+        DeferredInjectionBudgetMs,
+        TEXT("Time in milliseconds spent each frame injecting objects constructed outside of game thread"));
+}
+
+void UnrealDI_Impl::FDeferredInjectionQueue::Init()
+{
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FDeferredInjectionQueue::Tick));
+
+#if UE_VERSION_OLDER_THAN(5, 2, 0)
+    EndLoadPackageHandle = FCoreUObjectDelegates::OnEndLoadPackage.AddLambda([](TConstArrayView<UPackage*>) { Flush(); });
+#else
+    EndLoadPackageHandle = FCoreUObjectDelegates::OnEndLoadPackage.AddLambda([](const FEndLoadPackageContext&) { Flush(); });
+#endif
+
+    WorldInitializedActorsHandle = FWorldDelegates::OnWorldInitializedActors.AddLambda([](const FActorsInitializedParams&) { Flush(); });
+}
+
+void UnrealDI_Impl::FDeferredInjectionQueue::Shutdown()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    FCoreUObjectDelegates::OnEndLoadPackage.Remove(EndLoadPackageHandle);
+    FWorldDelegates::OnWorldInitializedActors.Remove(WorldInitializedActorsHandle);
+
+    Queue.Empty();
+}
+
+void UnrealDI_Impl::FDeferredInjectionQueue::Enqueue(UObject* Object)
+{
+    Queue.Enqueue(Object);
+}
+
+void UnrealDI_Impl::FDeferredInjectionQueue::Flush()
+{
+    check(IsInGameThread());
+
+    ProcessQueue(TNumericLimits<double>::Max());
+}
+
+bool UnrealDI_Impl::FDeferredInjectionQueue::Tick(float DeltaTime)
+{
+    ProcessQueue(DeferredInjectionBudgetMs / 1000.0);
+    return true;
+}
+
+void UnrealDI_Impl::FDeferredInjectionQueue::ProcessQueue(double TimeBudget)
+{
+    if (Queue.IsEmpty())
+    {
+        return;
+    }
+
+    const double EndTime = FPlatformTime::Seconds() + TimeBudget;
+
+    // objects that are still being loaded go back to the queue after this pass, so we don't loop over them forever
+    TArray<UObject*, TInlineAllocator<16>> NotLoadedObjects;
+
+    TWeakObjectPtr<UObject> WeakObject;
+    while (Queue.Dequeue(WeakObject))
+    {
+        if (UObject* Object = WeakObject.Get())
+        {
+            if (Object->HasAnyFlags(RF_NeedLoad | RF_NeedPostLoad))
+            {
+                NotLoadedObjects.Add(Object);
+            }
+            else
+            {
+                FInjectOnConstruction::TryInitDependenciesInternal(Object);
+            }
+        }
+
+        if (FPlatformTime::Seconds() >= EndTime)
+        {
+            break;
+        }
+    }
+
+    for (UObject* Object : NotLoadedObjects)
+    {
+        Queue.Enqueue(Object);
+    }
+}
@@ -1,6 +1,7 @@
 // Copyright Andrei Sudarikov. All Rights Reserved.
 
 #include "DI/Impl/DependenciesRegistry.h"
+#include "UObject/UObjectArray.h"
 
 void UnrealDI_Impl::FDependenciesRegistry::Init()
 {
@@ -25,10 +26,13 @@ void UnrealDI_Impl::FDependenciesRegistry::ProcessPendingRegistrations()
     {
         for (const FUnprocessedEntry& Entry : UnprocessedEntries)
         {
-            NativeInitFunctions.Emplace(Entry.ClassGetter(), Entry.InitFunction);
+            NativeInitFunctions.Emplace(Entry.ClassGetter(), Entry.NativeEntry);
         }
 
         UnprocessedEntries.Empty();
+
+        // newly loaded module may add InitDependencies to classes already known as non-injectable
+        InvalidateDerivedCaches();
     }
 }
 
@@ -48,9 +52,17 @@ void UnrealDI_Impl::FDependenciesRegistry::ClearBlueprintInitFunctionsCache()
             It.RemoveCurrent();
         }
     }
+
+    InvalidateDerivedCaches();
 }
 
 void UnrealDI_Impl::FDependenciesRegistry::FindInitFunctions(UClass* Class, FInitFunctionPtr& OutNativeInitFunction, UFunction*& OutBlueprintInitFunction)
+{
+    FMemoizedInitFunctionPtr MemoizedInitFunction = nullptr;
+    FindInitFunctions(Class, OutNativeInitFunction, MemoizedInitFunction, OutBlueprintInitFunction);
+}
+
+void UnrealDI_Impl::FDependenciesRegistry::FindInitFunctions(UClass* Class, FInitFunctionPtr& OutNativeInitFunction, FMemoizedInitFunctionPtr& OutMemoizedInitFunction, UFunction*& OutBlueprintInitFunction)
 {
     // check cache first
     FCacheEntry* CacheEntry = CachedInitFunctions.Find(Class);
@@ -61,9 +73,38 @@ void UnrealDI_Impl::FDependenciesRegistry::FindInitFunctions(UClass* Class, FIni
     }
 
     OutNativeInitFunction = CacheEntry->NativeInitFunction;
+    OutMemoizedInitFunction = CacheEntry->MemoizedInitFunction;
     OutBlueprintInitFunction = CacheEntry->BlueprintInitFunction;
 }
 
+bool UnrealDI_Impl::FDependenciesRegistry::IsInjectable(UClass* Class)
+{
+    const int32 Index = GUObjectArray.ObjectToIndex(Class);
+
+    if (Index < KnownClasses.Num() && KnownClasses[Index])
+    {
+        return InjectableClasses[Index];
+    }
+
+    FInitFunctionPtr NativeInitFunction = nullptr;
+    UFunction* BlueprintInitFunction = nullptr;
+    FindInitFunctions(Class, NativeInitFunction, BlueprintInitFunction);
+
+    const bool bInjectable = NativeInitFunction || BlueprintInitFunction;
+
+    if (Index >= KnownClasses.Num())
+    {
+        const int32 NumToAdd = Index + 1 - KnownClasses.Num();
+        KnownClasses.Add(false, NumToAdd);
+        InjectableClasses.Add(false, NumToAdd);
+    }
+
+    KnownClasses[Index] = true;
+    InjectableClasses[Index] = bInjectable;
+
+    return bInjectable;
+}
+
 FName UnrealDI_Impl::FDependenciesRegistry::MakeInitDependenciesFunctionName(UClass* Class)
 {
     return FName(FString::Printf(TEXT("InitDependencies_%s"), *Class->GetName()));
@@ -95,7 +136,11 @@ UnrealDI_Impl::FDependenciesRegistry::FCacheEntry* UnrealDI_Impl::FDependenciesR
         {
             if (!NewEntry.NativeInitFunction)
             {
-                NewEntry.NativeInitFunction = NativeInitFunctions.FindRef(ClassIterator);
+                if (const FNativeEntry* NativeEntry = NativeInitFunctions.Find(ClassIterator))
+                {
+                    NewEntry.NativeInitFunction = NativeEntry->InitFunction;
+                    NewEntry.MemoizedInitFunction = NativeEntry->MemoizedInitFunction;
+                }
             }
         }
 
@@ -107,11 +152,27 @@ UnrealDI_Impl::FDependenciesRegistry::FCacheEntry* UnrealDI_Impl::FDependenciesR
 
 void UnrealDI_Impl::FDependenciesRegistry::PostGarbageCollect()
 {
+    bool bAnyClassRemoved = false;
+
     for (auto It = CachedInitFunctions.CreateIterator(); It; ++It)
     {
         if (!It.Key().IsValid())
         {
             It.RemoveCurrent();
+            bAnyClassRemoved = true;
         }
     }
+
+    // object index of destroyed class may be reused by another class. Classes are rarely destroyed, so just start over
+    if (bAnyClassRemoved)
+    {
+        InvalidateDerivedCaches();
+    }
+}
+
+void UnrealDI_Impl::FDependenciesRegistry::InvalidateDerivedCaches()
+{
+    KnownClasses.Reset();
+    InjectableClasses.Reset();
+    ++Generation;
 }
@@ -4,7 +4,101 @@
 #include "DI/IInjector.h"
 #include "DI/IInjectorProvider.h"
 #include "DI/ObjectContainer.h"
+#include "DI/Impl/DependenciesRegistry.h"
+#include "DI/Impl/DeferredInjectionQueue.h"
 #include "Engine/World.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakInterfacePtr.h"
+
+namespace UnrealDI_Impl
+{
+    /* Container, Provider and per class Injectors of a single World. Accessed only from game thread */
+    struct FWorldInjectionCache
+    {
+        TWeakObjectPtr<UWorld> World;
+
+        // null if World has no container
+        TWeakObjectPtr<UObjectContainer> Container;
+        TWeakInterfacePtr<IInjectorProvider> Provider;
+        bool bInjectorStablePerClass = false;
+
+        // default provider always returns the container itself
+        bool bProviderIsContainer = false;
+
+        // filled only when bInjectorStablePerClass is set. Null value means class is not injected
+        TMap<FObjectKey, TWeakInterfacePtr<IInjector>> Injectors;
+    };
+
+    static TMap<FObjectKey, FWorldInjectionCache> WorldInjectionCaches;
+
+    static void InvalidateWorldInjectionCache(UWorld* World)
+    {
+        WorldInjectionCaches.Remove(FObjectKey(World));
+    }
+
+    static FWorldInjectionCache& FindOrAddWorldInjectionCache(UWorld* World)
+    {
+        FObjectKey WorldKey(World);
+
+        if (FWorldInjectionCache* Cache = WorldInjectionCaches.Find(WorldKey))
+        {
+            // stale pointers mean container was destroyed without ClearContainerForWorld call, so look it up again
+            if (!Cache->Container.IsStale() && !Cache->Provider.IsStale())
+            {
+                return *Cache;
+            }
+        }
+        else
+        {
+            // drop entries of destroyed worlds, this is rare enough to do on every insertion
+            for (auto It = WorldInjectionCaches.CreateIterator(); It; ++It)
+            {
+                if (!It->Value.World.IsValid())
+                {
+                    It.RemoveCurrent();
+                }
+            }
+        }
+
+        FWorldInjectionCache& Cache = WorldInjectionCaches.Add(WorldKey);
+        Cache.World = World;
+
+        if (UObjectContainer* Container = FInjectOnConstruction::GetContainerForWorld(World))
+        {
+            TScriptInterface<IInjectorProvider> Provider = Container->Resolve<IInjectorProvider>();
+
+            Cache.Container = Container;
+            Cache.Provider = TWeakInterfacePtr<IInjectorProvider>(Provider.GetObject());
+            Cache.bInjectorStablePerClass = Provider->IsInjectorStablePerClass();
+            Cache.bProviderIsContainer = Provider.GetObject() == Container;
+        }
+
+        return Cache;
+    }
+
+    static TScriptInterface<IInjector> GetCachedInjector(FWorldInjectionCache& Cache, UObject* Self)
+    {
+        IInjectorProvider* Provider = Cache.Provider.Get();
+        if (!Cache.bInjectorStablePerClass)
+        {
+            return Provider->GetInjector(Self);
+        }
+
+        FObjectKey ClassKey(Self->GetClass());
+        if (TWeakInterfacePtr<IInjector>* Injector = Cache.Injectors.Find(ClassKey))
+        {
+            if (!Injector->IsStale())
+            {
+                return Injector->ToScriptInterface();
+            }
+        }
+
+        TScriptInterface<IInjector> Injector = Provider->GetInjector(Self);
+        Cache.Injectors.Add(ClassKey, TWeakInterfacePtr<IInjector>(Injector.GetObject()));
+
+        return Injector;
+    }
+}
 
 void FInjectOnConstruction::SetContainerForWorld(UWorld* World, class UObjectContainer* Container)
 {
@@ -13,6 +107,7 @@ void FInjectOnConstruction::SetContainerForWorld(UWorld* World, class UObjectCon
 
     ClearContainerForWorld(World);
     World->PerModuleDataObjects.Add(Container);
+    UnrealDI_Impl::InvalidateWorldInjectionCache(World);
 }
 
 void FInjectOnConstruction::ClearContainerForWorld(UWorld* World)
@@ -20,6 +115,7 @@ void FInjectOnConstruction::ClearContainerForWorld(UWorld* World)
     check(World);
 
     World->PerModuleDataObjects.RemoveAllSwap([&](TObjectPtr<UObject> Obj) { return Obj->IsA<UObjectContainer>(); });
+    UnrealDI_Impl::InvalidateWorldInjectionCache(World);
 }
 
 UObjectContainer* FInjectOnConstruction::GetContainerForWorld(UWorld* World)
@@ -41,17 +137,44 @@ void FInjectOnConstruction::TryInitDependencies(UObject* Self)
 
 void FInjectOnConstruction::TryInitDependenciesInternal(UObject* Self)
 {
+    using namespace UnrealDI_Impl;
+
+    if (!IsInGameThread())
+    {
+        // neither World nor Container may be accessed from here. Inject later on game thread
+        FDeferredInjectionQueue::Enqueue(Self);
+        return;
+    }
+
     UWorld* World = Self->GetWorld();
-    UObjectContainer* Container = GetContainerForWorld(World);
+    if (World == nullptr)
+    {
+        return;
+    }
 
-    if (Container)
+    FWorldInjectionCache& Cache = FindOrAddWorldInjectionCache(World);
+    if (!Cache.Container.IsValid())
     {
-        TScriptInterface<IInjectorProvider> Provider = Container->Resolve<IInjectorProvider>();
+        return;
+    }
 
-        TScriptInterface<IInjector> Injector = Provider->GetInjector(Self);
-        if (Injector != nullptr)
-        {
-            Injector->Inject(Self);
-        }
+    // most of constructed objects have nothing to inject. UObjectContainer skips them anyway, so do it before asking for injector
+    if (Cache.bProviderIsContainer && !FDependenciesRegistry::IsInjectable(Self->GetClass()))
+    {
+        return;
     }
+
+    TScriptInterface<IInjector> Injector = GetCachedInjector(Cache, Self);
+    if (Injector == nullptr)
+    {
+        return;
+    }
+
+    // custom injectors may inject classes without InitDependencies, so only UObjectContainer is skipped
+    if (!Cache.bProviderIsContainer && Injector.GetObject()->IsA<UObjectContainer>() && !FDependenciesRegistry::IsInjectable(Self->GetClass()))
+    {
+        return;
+    }
+
+    Injector->Inject(Self);
 }
@@ -0,0 +1,160 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/LevelInjectionSubsystem.h"
+#include "DI/IInjector.h"
+#include "DI/IInjectorProvider.h"
+#include "DI/InjectOnConstruction.h"
+#include "DI/ObjectContainer.h"
+#include "DI/ObjectContainerDelegates.h"
+#include "Components/ActorComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+int32 ULevelInjectionSubsystem::InjectLevel(ULevel* Level)
+{
+    return InjectLevelImpl(Level, TSet<FObjectKey>());
+}
+
+int32 ULevelInjectionSubsystem::InjectLevelImpl(ULevel* Level, const TSet<FObjectKey>& SkippedObjects)
+{
+    check(Level);
+
+    UObjectContainer* Container = FInjectOnConstruction::GetContainerForWorld(Level->GetWorld());
+    if (Container == nullptr)
+    {
+        return 0;
+    }
+
+    TScriptInterface<IInjectorProvider> Provider = Container->Resolve<IInjectorProvider>();
+
+    // cheap per-class check first, so we don't ask provider about objects without InitDependencies
+    TMap<UClass*, bool, TInlineSetAllocator<64>> CanInjectClass;
+
+    struct FBatch
+    {
+        TScriptInterface<IInjector> Injector;
+        TArray<UObject*> Objects;
+    };
+
+    // provider may select different injectors for different objects. Collect batch for each of them
+    TArray<FBatch, TInlineAllocator<2>> Batches;
+
+    auto AddCandidate = [&](UObject* Object)
+    {
+        if (SkippedObjects.Contains(FObjectKey(Object)))
+        {
+            return;
+        }
+
+        UClass* Class = Object->GetClass();
+
+        bool* bCanInject = CanInjectClass.Find(Class);
+        if (bCanInject == nullptr)
+        {
+            bCanInject = &CanInjectClass.Add(Class, Container->CanInject(Class));
+        }
+
+        if (*bCanInject)
+        {
+            TScriptInterface<IInjector> Injector = Provider->GetInjector(Object);
+            if (Injector == nullptr)
+            {
+                return;
+            }
+
+            FBatch* Batch = Batches.FindByPredicate([&](const FBatch& Existing) { return Existing.Injector == Injector; });
+            if (Batch == nullptr)
+            {
+                Batch = &Batches.Add_GetRef({ Injector });
+            }
+
+            Batch->Objects.Add(Object);
+        }
+    };
+
+    for (AActor* Actor : Level->Actors)
+    {
+        if (!IsValid(Actor))
+        {
+            continue;
+        }
+
+        AddCandidate(Actor);
+
+        Actor->ForEachComponent(false, [&](UActorComponent* Component)
+        {
+            AddCandidate(Component);
+        });
+    }
+
+    int32 NumInjected = 0;
+    for (const FBatch& Batch : Batches)
+    {
+        NumInjected += Batch.Injector->InjectAll(Batch.Objects);
+    }
+
+    return NumInjected;
+}
+
+bool ULevelInjectionSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    return GetDefault<ULevelInjectionSubsystem>()->bEnabled && Super::ShouldCreateSubsystem(Outer);
+}
+
+void ULevelInjectionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // streamed levels must be injected before their actors are initialized, LevelAddedToWorld is broadcast only after BeginPlay was routed to them
+    LevelAddedHandle = FWorldDelegates::OnPreLevelAddedToWorld.AddUObject(this, &ThisClass::OnPreLevelAddedToWorld);
+
+    // objects created by containers before BeginPlay are already injected and must not be injected again with their level
+    ObjectInjectedHandle = FObjectContainerDelegates::OnObjectInjectedDelegate.AddUObject(this, &ThisClass::OnObjectInjected);
+}
+
+void ULevelInjectionSubsystem::Deinitialize()
+{
+    FWorldDelegates::OnPreLevelAddedToWorld.Remove(LevelAddedHandle);
+    FObjectContainerDelegates::OnObjectInjectedDelegate.Remove(ObjectInjectedHandle);
+
+    Super::Deinitialize();
+}
+
+void ULevelInjectionSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // inject persistent level and all streaming levels that became visible before BeginPlay
+    for (ULevel* Level : InWorld.GetLevels())
+    {
+        InjectLevelImpl(Level, InjectedBeforeBeginPlay);
+    }
+
+    // levels added later contain only loaded actors, so objects created by containers from now on are never injected with a level
+    FObjectContainerDelegates::OnObjectInjectedDelegate.Remove(ObjectInjectedHandle);
+    ObjectInjectedHandle.Reset();
+    InjectedBeforeBeginPlay.Empty();
+}
+
+bool ULevelInjectionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void ULevelInjectionSubsystem::OnPreLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+    // levels added before BeginPlay are processed in OnWorldBeginPlay
+    if (World == GetWorld() && World->HasBegunPlay() && Level != nullptr)
+    {
+        InjectLevel(Level);
+    }
+}
+
+void ULevelInjectionSubsystem::OnObjectInjected(UObject& Object, const UObjectContainer& Container)
+{
+    if ((Object.IsA<AActor>() || Object.IsA<UActorComponent>()) && Object.GetWorld() == GetWorld())
+    {
+        InjectedBeforeBeginPlay.Add(FObjectKey(&Object));
+    }
+}
@@ -0,0 +1,13 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/Impl/Lifetimes.h"
+
+namespace UnrealDI_Impl
+{
+    FLifetimeHandler& FLifetimeHandler_Transient::Make(FLifetimeHandlerArena& Arena)
+    {
+        // defined here, so all modules share the same instance
+        static FLifetimeHandler_Transient Handler;
+        return Handler;
+    }
+}
@@ -2,22 +2,82 @@
 
 #include "DI/ObjectContainer.h"
 #include "DI/ObjectContainerDelegates.h"
+#include "DI/Factory.h"
 #include "DI/ObjectsCollection.h"
 #include "DI/Impl/DefaultInstanceFactory.h"
 #include "DI/Impl/DependenciesRegistry.h"
 #include "DI/Impl/Lifetimes.h"
 #include "Algo/Copy.h"
+#include <atomic>
 
 FObjectContainerDelegates::FOnObjectCreated FObjectContainerDelegates::OnObjectConstructedDelegate;
 FObjectContainerDelegates::FOnObjectCreated FObjectContainerDelegates::OnObjectInjectedDelegate;
 FObjectContainerDelegates::FOnObjectCreated FObjectContainerDelegates::OnObjectCreatedDelegate;
 
+namespace UnrealDI_Impl
+{
+    struct FResolveHandleData
+    {
+        // copy of registration. It stays valid even if Registrations map is reallocated, because all its parts are either values, shared or owned by the container
+        UObjectContainer::FResolver Resolver;
+        const UObjectContainer* OwningContainer;
+
+#if !UE_BUILD_SHIPPING
+        // used only to detect misuse of a handle
+        UClass* Type;
+        TWeakObjectPtr<const UObjectContainer> RequestingContainer;
+        mutable uint32 Generation;
+#endif
+    };
+
+    static void BroadcastForEach(const FObjectContainerDelegates::FOnObjectCreated& Delegate, TArrayView<UObject*> Objects, const UObjectContainer& Container)
+    {
+        // check for listeners once per batch, not once per object
+        if (Delegate.IsBound())
+        {
+            for (UObject* Object : Objects)
+            {
+                Delegate.Broadcast(*Object, Container);
+            }
+        }
+    }
+
+    static FObjectCreationParams GetCreationParams(const FFactoryCallParams* Params, EObjectNamingPolicy RegistrationNamingPolicy)
+    {
+        FObjectCreationParams Result = Params != nullptr && Params->CreationParams != nullptr ? *Params->CreationParams : FObjectCreationParams();
+        if (Result.NamingPolicy == EObjectNamingPolicy::Default)
+        {
+            Result.NamingPolicy = RegistrationNamingPolicy;
+        }
+
+        return Result;
+    }
+}
+
+UObjectContainer::UObjectContainer()
+    : LifetimeHandlers(MakeUnique<UnrealDI_Impl::FLifetimeHandlerArena>())
+{
+}
+
+// defined here, where FLifetimeHandlerArena is complete
+UObjectContainer::~UObjectContainer() = default;
+
 UObject* UObjectContainer::Resolve(UClass* Type) const
 {
     checkf(Type, TEXT("Requested object of null type"));
 
+    return ResolveSingleImpl<true>(Type);
+}
+
+UObject* UObjectContainer::Resolve(UClass* Type, const FObjectCreationParams& Params) const
+{
+    checkf(Type, TEXT("Requested object of null type"));
+
+    UnrealDI_Impl::FFactoryCallParams CallParams;
+    CallParams.CreationParams = &Params;
+
     const auto [Resolver, Container] = GetResolver<true>(Type);
-    return ResolveImpl(*Resolver, Container);
+    return ResolveImpl(*Resolver, Container, &CallParams);
 }
 
 TObjectsCollection<UObject> UObjectContainer::ResolveAll(UClass* Type) const
@@ -32,15 +92,14 @@ TFactory<UObject> UObjectContainer::ResolveFactory(UClass* Type) const
     checkf(Type, TEXT("Requested object of null type"));
 
     const auto [Resolver, Container] = GetResolver<true>(Type);
-    return TFactory<UObject>(*Container, &ThisClass::ResolveFromContext);
+    return Container->MakeBoundFactory(Type, *Resolver);
 }
 
 UObject* UObjectContainer::TryResolve(UClass* Type) const
 {
     checkf(Type, TEXT("Requested object of null type"));
 
-    const auto [Resolver, Container] = GetResolver<false>(Type);
-    return Resolver != nullptr ? ResolveImpl(*Resolver, Container) : nullptr;
+    return ResolveSingleImpl<false>(Type);
 }
 
 TObjectsCollection<UObject> UObjectContainer::TryResolveAll(UClass* Type) const
@@ -55,7 +114,7 @@ TFactory<UObject> UObjectContainer::TryResolveFactory(UClass* Type) const
     checkf(Type, TEXT("Requested object of null type"));
 
     const auto [Resolver, Container] = GetResolver<false>(Type);
-    return Resolver != nullptr ? TFactory<UObject>(*Container, &ThisClass::ResolveFromContext) : TFactory<UObject>();
+    return Resolver != nullptr ? Container->MakeBoundFactory(Type, *Resolver) : TFactory<UObject>();
 }
 
 bool UObjectContainer::IsRegistered(UClass* Type) const
@@ -76,55 +135,160 @@ bool UObjectContainer::IsRegistered(UClass* Type) const
 
 bool UObjectContainer::Inject(UObject* Object) const
 {
-    using namespace UnrealDI_Impl;
     check(Object);
 
-    UClass* Class = Object->GetClass();
+    FInjectionPlan Plan;
+    Plan.Bind(Object->GetClass());
 
-    FDependenciesRegistry::FInitFunctionPtr NativeInitFunction = nullptr;
-    UFunction* BlueprintInitFunction = nullptr;
+    return InjectWithPlan(*Object, Plan);
+}
 
-    FDependenciesRegistry::FindInitFunctions(Class, NativeInitFunction, BlueprintInitFunction);
+int32 UObjectContainer::InjectAll(TConstArrayView<UObject*> Objects) const
+{
+    // init functions are looked up once per class
+    TMap<UClass*, FInjectionPlan, TInlineSetAllocator<16>> Plans;
+
+    // shared objects are resolved once per batch. Reuse cache of outer batch if there is one
+    TMap<UClass*, UObject*> ResolveCache;
+    TGuardValue<TMap<UClass*, UObject*>*> CacheGuard(BatchResolveCache, BatchResolveCache != nullptr ? BatchResolveCache : &ResolveCache);
+
+    int32 NumInjected = 0;
+
+    for (UObject* Object : Objects)
+    {
+        check(Object);
+
+        UClass* Class = Object->GetClass();
+
+        FInjectionPlan* Plan = Plans.Find(Class);
+        if (Plan == nullptr)
+        {
+            Plan = &Plans.Add(Class);
+            Plan->Bind(Class);
+        }
+
+        NumInjected += InjectWithPlan(*Object, *Plan) ? 1 : 0;
+    }
+
+    return NumInjected;
+}
+
+UObjectContainer::FInjectionPlan& UObjectContainer::FResolver::GetInjectionPlan() const
+{
+    if (!InjectionPlan.IsValid())
+    {
+        InjectionPlan = MakeShared<FInjectionPlan>();
+    }
+
+    return *InjectionPlan;
+}
+
+void UObjectContainer::FInjectionPlan::Bind(UClass* InClass)
+{
+    using namespace UnrealDI_Impl;
+
+    const uint32 CurrentGeneration = FDependenciesRegistry::GetGeneration();
+    if (Class == InClass && RegistryGeneration == CurrentGeneration)
+    {
+        return;
+    }
+
+    Class = InClass;
+    RegistryGeneration = CurrentGeneration;
+
+    FDependenciesRegistry::FindInitFunctions(Class, NativeInitFunction, MemoizedInitFunction, BlueprintInitFunction);
 
+    MemoizedArguments.Reset();
+    BlueprintArguments.Reset();
+    if (BlueprintInitFunction != nullptr)
+    {
+        GatherBlueprintInitArguments(*BlueprintInitFunction, BlueprintArguments);
+    }
+}
+
+bool UObjectContainer::InjectWithPlan(UObject& Object, FInjectionPlan& Plan, bool bReuseArguments) const
+{
     // first - call native InitDependencies
-    if (NativeInitFunction != nullptr)
+    if (bReuseArguments && Plan.MemoizedInitFunction != nullptr)
     {
-        NativeInitFunction(*Object, *static_cast<const IResolver*>(this));
+        // registrations changed since arguments were stored, they may resolve to different objects now
+        if (Plan.ContainerGeneration != Generation)
+        {
+            Plan.MemoizedArguments.Reset();
+            Plan.ContainerGeneration = Generation;
+        }
+
+        Plan.MemoizedInitFunction(Object, *static_cast<const IResolver*>(this), Plan.MemoizedArguments, [this](UClass* Type)
+        {
+            const auto [Resolver, _] = GetResolver<false>(Type);
+            return Resolver != nullptr && Resolver->LifetimeHandler->IsPermanent();
+        });
+
+        // plan belongs to a registration of this container, so it lives as long as the container
+        if (Plan.MemoizedArguments.IsValid() && !Plan.bReportsArguments)
+        {
+            Plan.bReportsArguments = true;
+            MemoizingPlans.Add(&Plan);
+        }
+    }
+    else if (Plan.NativeInitFunction != nullptr)
+    {
+        Plan.NativeInitFunction(Object, *static_cast<const IResolver*>(this));
     }
 
     // then -  call blueprint InitDependencies
-    if (BlueprintInitFunction != nullptr)
+    if (Plan.BlueprintInitFunction != nullptr)
     {
-        uint8* Arguments = (uint8*)FMemory_Alloca(BlueprintInitFunction->ParmsSize);
-        FMemory::Memzero(Arguments, BlueprintInitFunction->ParmsSize);
+        InvokeBlueprintInitFunction(Object, *Plan.BlueprintInitFunction, Plan.BlueprintArguments);
+    }
 
-        uint8* CurrentArgument = Arguments;
+    return Plan.NativeInitFunction || Plan.BlueprintInitFunction;
+}
 
-        // prepare arguments
-        for (TFieldIterator<FProperty> It(BlueprintInitFunction, EFieldIterationFlags::None); It; ++It)
+void UObjectContainer::GatherBlueprintInitArguments(UFunction& Function, FBlueprintInitArguments& OutArguments)
+{
+    for (TFieldIterator<FProperty> It(&Function, EFieldIterationFlags::None); It; ++It)
+    {
+        if (It->HasAllPropertyFlags(CPF_Parm))
         {
-            if (It->HasAllPropertyFlags(CPF_Parm))
+            if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(*It))
+            {
+                OutArguments.Add({ ObjectProperty->PropertyClass, false });
+            }
+            else if (FInterfaceProperty* InterfaceProperty = CastField<FInterfaceProperty>(*It))
             {
-                if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(*It))
-                {
-                    new (CurrentArgument) TObjectPtr<UObject>(Resolve(ObjectProperty->PropertyClass));
-                    CurrentArgument += sizeof(TObjectPtr<UObject>);
-                }
-                else if (FInterfaceProperty* InterfaceProperty = CastField<FInterfaceProperty>(*It))
-                {
-                    UObject* Result = Resolve(InterfaceProperty->InterfaceClass);
-                    new (CurrentArgument) FScriptInterface(Result, Result->GetInterfaceAddress(InterfaceProperty->InterfaceClass));
-                    CurrentArgument += sizeof(FScriptInterface);
-                }
+                OutArguments.Add({ InterfaceProperty->InterfaceClass, true });
             }
         }
+    }
+}
 
-        check(CurrentArgument - Arguments == BlueprintInitFunction->ParmsSize);
+void UObjectContainer::InvokeBlueprintInitFunction(UObject& Object, UFunction& Function, TConstArrayView<FBlueprintInitArgument> Arguments) const
+{
+    uint8* Parameters = (uint8*)FMemory_Alloca(Function.ParmsSize);
+    FMemory::Memzero(Parameters, Function.ParmsSize);
+
+    uint8* CurrentParameter = Parameters;
 
-        Object->ProcessEvent(BlueprintInitFunction, Arguments);
+    // prepare arguments
+    for (const FBlueprintInitArgument& Argument : Arguments)
+    {
+        if (!Argument.bIsInterface)
+        {
+            new (CurrentParameter) TObjectPtr<UObject>(Resolve(Argument.Type));
+            CurrentParameter += sizeof(TObjectPtr<UObject>);
+        }
+        else
+        {
+            UObject* Result = Resolve(Argument.Type);
+            new (CurrentParameter) FScriptInterface(Result, Result->GetInterfaceAddress(Argument.Type));
+            CurrentParameter += sizeof(FScriptInterface);
+        }
     }
 
-    return NativeInitFunction || BlueprintInitFunction;
+    check(CurrentParameter - Parameters == Function.ParmsSize);
+
+    Object.ProcessEvent(&Function, Parameters);
 }
 
 bool UObjectContainer::CanInject(UClass* Class) const
@@ -145,11 +309,165 @@ TScriptInterface<IInjector> UObjectContainer::GetInjector(UObject* InjectTarget)
     return const_cast<UObjectContainer*>(this);
 }
 
-void UObjectContainer::AddRegistration(UClass* Interface, TSoftClassPtr<UObject> EffectiveClass, const TSharedRef<UnrealDI_Impl::FLifetimeHandler>& Lifetime)
+UObjectContainer* UObjectContainer::Clone(UObject* Outer) const
+{
+    UObjectContainer* Result = NewObject<UObjectContainer>(Outer != nullptr ? Outer : GetOuter());
+    Result->OuterForNewObjects = OuterForNewObjects == GetOuter() ? Result->GetOuter() : OuterForNewObjects.Get();
+    Result->ParentContainer = ParentContainer;
+    Result->CopyRegistrations(Registrations, SoftEffectiveClasses, this);
+    Result->RegisteredSubtypes = RegisteredSubtypes;
+    Result->AutoCreatedTypes = AutoCreatedTypes;
+
+    Result->FinalizeCreation();
+
+    return Result;
+}
+
+void UObjectContainer::CopyRegistrations(const TMap<UClass*, FResolversArray>& Source, const FSoftClassesArray& SourceSoftClasses, const UObjectContainer* SourceContainer)
+{
+    using namespace UnrealDI_Impl;
+
+    Registrations = Source;
+    SoftEffectiveClasses = SourceSoftClasses;
+
+    // single handler may serve several registrations (e.g. all interfaces of a type), copies must keep them together
+    TMap<const FLifetimeHandler*, FLifetimeHandler*> CopiedHandlers;
+
+    for (auto& Pair : Registrations)
+    {
+        for (FResolver& Resolver : Pair.Value)
+        {
+            FLifetimeHandler& Handler = *Resolver.LifetimeHandler;
+
+            if (FLifetimeHandler** CopiedHandler = CopiedHandlers.Find(&Handler))
+            {
+                Resolver.LifetimeHandler = *CopiedHandler;
+            }
+            else if (SourceContainer != nullptr && Handler.IsPermanent() && Handler.Get() == SourceContainer)
+            {
+                // registrations of source container itself
+                Resolver.LifetimeHandler = CopiedHandlers.Add(&Handler, &LifetimeHandlers->Create<FLifetimeHandler_Instance>(this));
+            }
+            else
+            {
+                // handlers of Source belong to another owner, which may be destroyed before this container
+                Resolver.LifetimeHandler = CopiedHandlers.Add(&Handler, &Handler.CreateForClone(*LifetimeHandlers));
+            }
+
+            // plan keeps arguments resolved from the container that used it, so every copy creates its own plan on first use
+            Resolver.InjectionPlan.Reset();
+        }
+    }
+
+    // Registrations are ordered by type, not by lifetime, so repeated lifetimes are filtered here
+    StrongReferences.Reset();
+    CustomLifetimes.Reset();
+
+    TSet<const FLifetimeHandler*> TrackedHandlers;
+    for (auto& Pair : Registrations)
+    {
+        for (FResolver& Resolver : Pair.Value)
+        {
+            bool bAlreadyTracked = false;
+            TrackedHandlers.Add(Resolver.LifetimeHandler, &bAlreadyTracked);
+
+            if (!bAlreadyTracked)
+            {
+                TrackLifetimeReferences(*Resolver.LifetimeHandler);
+            }
+        }
+    }
+
+    Generation = MakeUniqueGeneration();
+}
+
+void UObjectContainer::AddRegistration(UClass* Interface, TSoftClassPtr<UObject> EffectiveClass, UnrealDI_Impl::FLifetimeHandler& Lifetime, EObjectNamingPolicy NamingPolicy)
+{
+    AddResolver(Interface, MakeResolver(EffectiveClass, Lifetime, NamingPolicy, SoftEffectiveClasses));
+}
+
+UObjectContainer::FResolver UObjectContainer::MakeResolver(const TSoftClassPtr<UObject>& EffectiveClass, UnrealDI_Impl::FLifetimeHandler& Lifetime, EObjectNamingPolicy NamingPolicy, FSoftClassesArray& OutSoftClasses)
+{
+    UClass* Class = EffectiveClass.Get();
+    if (Class != nullptr && Class->HasAnyClassFlags(CLASS_Native))
+    {
+        return FResolver{ Class, INDEX_NONE, NamingPolicy, &Lifetime };
+    }
+
+    return FResolver{ nullptr, OutSoftClasses.Add(EffectiveClass), NamingPolicy, &Lifetime };
+}
+
+UClass* UObjectContainer::LoadEffectiveClass(const FResolver& Resolver) const
+{
+    return Resolver.NativeClass != nullptr ? Resolver.NativeClass : SoftEffectiveClasses[Resolver.SoftClassIndex].LoadSynchronous();
+}
+
+UObjectContainer::FResolversArray& UObjectContainer::AddResolver(UClass* Type, FResolver&& Resolver)
+{
+    FResolversArray* Resolvers = Registrations.Find(Type);
+
+    if (Resolvers == nullptr)
+    {
+        Resolvers = &Registrations.Add(Type);
+
+        // keep already built subtype lists up to date
+        for (auto& Pair : RegisteredSubtypes)
+        {
+            if (Type->IsChildOf(Pair.Key))
+            {
+                Pair.Value.Add(Type);
+            }
+        }
+    }
+
+    Resolvers->Emplace(MoveTemp(Resolver));
+    TrackLifetimeReferences(*Resolvers->Last().LifetimeHandler);
+
+    // pointers to existing resolvers may have become invalid
+    Generation = MakeUniqueGeneration();
+
+    return *Resolvers;
+}
+
+void UObjectContainer::TrackLifetimeReferences(UnrealDI_Impl::FLifetimeHandler& Handler)
+{
+    using namespace UnrealDI_Impl;
+
+    // registrations sharing a lifetime are added one after another, so checking the last entry is enough to skip repeated ones
+    if (TObjectPtr<UObject>* Storage = Handler.GetHeldObjectStorage())
+    {
+        if (StrongReferences.Num() == 0 || StrongReferences.Last() != Storage)
+        {
+            StrongReferences.Add(Storage);
+        }
+    }
+    else if (Handler.GetKind() == ELifetimeKind::Custom)
+    {
+        if (CustomLifetimes.Num() == 0 || CustomLifetimes.Last() != &Handler)
+        {
+            CustomLifetimes.Add(&Handler);
+        }
+    }
+}
+
+void UObjectContainer::AddSelfRegistrations()
 {
-    FResolversArray& Resolvers = Registrations.FindOrAdd(Interface);
+    using namespace UnrealDI_Impl;
+
+    FLifetimeHandler& ContainerInstance = LifetimeHandlers->Create<FLifetimeHandler_Instance>(this);
+
+    // register container itself as IResolver
+    AddRegistration(UResolver::StaticClass(), UObjectContainer::StaticClass(), ContainerInstance);
+
+    // register container itself as IInjector
+    AddRegistration(UInjector::StaticClass(), UObjectContainer::StaticClass(), ContainerInstance);
 
-    Resolvers.Emplace(FResolver{ MoveTemp(EffectiveClass), Lifetime });
+    // register container itself as IInjectorProvider, if not customized in either self or parent
+    auto [Resolver, _] = FindResolver(UInjectorProvider::StaticClass());
+    if (Resolver == nullptr || Resolver->NativeClass == UObjectContainer::StaticClass())
+    {
+        AddRegistration(UInjectorProvider::StaticClass(), UObjectContainer::StaticClass(), ContainerInstance);
+    }
 }
 
 void UObjectContainer::FinalizeCreation()
@@ -171,6 +489,12 @@ void UObjectContainer::FinalizeCreation()
 
     // order by 'most recently added'
     Algo::Reverse(InstanceFactories);
+
+    // resolve all classes that are marked with bAutoCreate
+    for (UClass* Type : AutoCreatedTypes)
+    {
+        Resolve(Type);
+    }
 }
 
 template <bool bCheck>
@@ -195,7 +519,8 @@ TTuple<const UObjectContainer::FResolver*, const UObjectContainer*> UObjectConta
     }
 
     // auto-register Type if no registration found for it
-    FResolversArray& NewArray = const_cast<UObjectContainer*>(this)->Registrations.Emplace(Type, { FResolver { Type, MakeShared<UnrealDI_Impl::FLifetimeHandler_Transient>() } });
+    UObjectContainer* MutableThis = const_cast<UObjectContainer*>(this);
+    FResolversArray& NewArray = MutableThis->AddResolver(Type, MakeResolver(Type, UnrealDI_Impl::FLifetimeHandler_Transient::Make(*MutableThis->LifetimeHandlers), EObjectNamingPolicy::Default, MutableThis->SoftEffectiveClasses));
 
     return MakeTuple(&NewArray.Last(), this);
 }
@@ -230,30 +555,57 @@ IInstanceFactory* UObjectContainer::FindInstanceFactory(UClass* Type) const
     return ParentContainer->FindInstanceFactory(Type);
 }
 
-UObject* UObjectContainer::ResolveImpl(const FResolver& Resolver, const UObjectContainer* OwningContainer)
+UObject* UObjectContainer::ResolveImpl(const FResolver& Resolver, const UObjectContainer* OwningContainer, const UnrealDI_Impl::FFactoryCallParams* Params)
 {
     // cache reference to LifetimeHandler, because reference to Resolver may become invalid during call to Inject due to Registrations map memory reallocation
-    UnrealDI_Impl::FLifetimeHandler& LifetimeHandler = Resolver.LifetimeHandler.Get();
+    UnrealDI_Impl::FLifetimeHandler& LifetimeHandler = *Resolver.LifetimeHandler;
 
     UObject* Result = LifetimeHandler.Get();
     if (Result == nullptr)
     {
-        UClass* EffectiveClass = Resolver.EffectiveClass.LoadSynchronous();
+        // same as LifetimeHandler, take InjectionPlan while Resolver is still valid
+        FInjectionPlan& Plan = Resolver.GetInjectionPlan();
+
+        UClass* EffectiveClass = OwningContainer->LoadEffectiveClass(Resolver);
         check(EffectiveClass != nullptr);
 
         // create and initialize instance
         IInstanceFactory* Factory = OwningContainer->FindInstanceFactory(EffectiveClass);
         check(Factory != nullptr);
 
-        Result = Factory->Create(OwningContainer->OuterForNewObjects, EffectiveClass);
-        checkf(Result != nullptr, TEXT("IInstanceFactory must never return nullptr. Check project specific implementation"));
+        const FObjectCreationParams CreationParams = UnrealDI_Impl::GetCreationParams(Params, Resolver.NamingPolicy);
+
+        UObject* Outer = CreationParams.Outer != nullptr ? CreationParams.Outer : OwningContainer->OuterForNewObjects.Get();
+
+        // lifetime may provide object by itself (e.g. take it from a pool)
+        bool bIsReused = false;
+        Result = LifetimeHandler.Create(Outer, EffectiveClass, bIsReused);
+
+        if (bIsReused)
+        {
+            // object already received its dependencies when it was provided for the first time, only notify that it is handed out again
+            FObjectContainerDelegates::OnObjectCreatedDelegate.Broadcast(*Result, *OwningContainer);
+            return Result;
+        }
+
+        if (Result == nullptr)
+        {
+            Result = Factory->CreateWithParams(Outer, EffectiveClass, CreationParams);
+            checkf(Result != nullptr, TEXT("IInstanceFactory must never return nullptr. Check project specific implementation"));
+        }
         FObjectContainerDelegates::OnObjectConstructedDelegate.Broadcast(*Result, *OwningContainer);
 
-        // Resolver may become invalid after this call to Inject
-        OwningContainer->Inject(Result);
+        // Resolver may become invalid after this call to InjectWithPlan
+        Plan.Bind(Result->GetClass());
+        OwningContainer->InjectWithPlan(*Result, Plan, true);
         FObjectContainerDelegates::OnObjectInjectedDelegate.Broadcast(*Result, *OwningContainer);
 
-        Factory->FinalizeCreation(Result);
+        if (Params != nullptr && Params->Initializer != nullptr)
+        {
+            (*Params->Initializer)(*Result);
+        }
+
+        Factory->FinalizeCreationWithParams(Result, CreationParams);
 
         LifetimeHandler.Set(Result);
 
@@ -263,6 +615,91 @@ UObject* UObjectContainer::ResolveImpl(const FResolver& Resolver, const UObjectC
     return Result;
 }
 
+void UObjectContainer::ResolveManyImpl(const FResolver& Resolver, const UObjectContainer* OwningContainer, TArrayView<UObject*> OutObjects, const UnrealDI_Impl::FFactoryCallParams& Params)
+{
+    // make a copy of Resolver, because reference to it may become invalid during call to Inject.
+    // Create InjectionPlan before that, so the copy shares it with the registration
+    Resolver.GetInjectionPlan();
+    const FResolver ResolverCopy = Resolver;
+
+    if (!ResolverCopy.LifetimeHandler->IsTransient())
+    {
+        // let the lifetime decide whether new objects should be created
+        for (UObject*& Object : OutObjects)
+        {
+            Object = ResolveImpl(ResolverCopy, OwningContainer, &Params);
+        }
+
+        return;
+    }
+
+    UClass* EffectiveClass = OwningContainer->LoadEffectiveClass(ResolverCopy);
+    check(EffectiveClass != nullptr);
+
+    IInstanceFactory* Factory = OwningContainer->FindInstanceFactory(EffectiveClass);
+    check(Factory != nullptr);
+
+    const FObjectCreationParams CreationParams = UnrealDI_Impl::GetCreationParams(&Params, ResolverCopy.NamingPolicy);
+    UObject* Outer = CreationParams.Outer != nullptr ? CreationParams.Outer : OwningContainer->OuterForNewObjects.Get();
+
+    // create all instances first. Actors are spawned deferred and will be finished after all of them are injected
+    Factory->CreateMany(Outer, EffectiveClass, CreationParams, OutObjects);
+    for (UObject* Object : OutObjects)
+    {
+        checkf(Object != nullptr, TEXT("IInstanceFactory must never return nullptr. Check project specific implementation"));
+    }
+    UnrealDI_Impl::BroadcastForEach(FObjectContainerDelegates::OnObjectConstructedDelegate, OutObjects, *OwningContainer);
+
+    FInjectionPlan& Plan = ResolverCopy.GetInjectionPlan();
+    for (UObject* Object : OutObjects)
+    {
+        Plan.Bind(Object->GetClass());
+        OwningContainer->InjectWithPlan(*Object, Plan, true);
+    }
+    UnrealDI_Impl::BroadcastForEach(FObjectContainerDelegates::OnObjectInjectedDelegate, OutObjects, *OwningContainer);
+
+    if (Params.Initializer != nullptr)
+    {
+        for (UObject* Object : OutObjects)
+        {
+            (*Params.Initializer)(*Object);
+        }
+    }
+
+    Factory->FinalizeCreationMany(OutObjects, CreationParams);
+    UnrealDI_Impl::BroadcastForEach(FObjectContainerDelegates::OnObjectCreatedDelegate, OutObjects, *OwningContainer);
+}
+
+template <bool bCheck>
+UObject* UObjectContainer::ResolveSingleImpl(UClass* Type) const
+{
+    if (BatchResolveCache != nullptr)
+    {
+        if (UObject** CachedObject = BatchResolveCache->Find(Type))
+        {
+            return *CachedObject;
+        }
+    }
+
+    const auto [Resolver, Container] = GetResolver<bCheck>(Type);
+    if (Resolver == nullptr)
+    {
+        return nullptr;
+    }
+
+    // check lifetime before ResolveImpl, because it may invalidate Resolver
+    const bool bCacheResult = BatchResolveCache != nullptr && Resolver->LifetimeHandler->IsShared();
+
+    UObject* Result = ResolveImpl(*Resolver, Container);
+
+    if (bCacheResult)
+    {
+        BatchResolveCache->Add(Type, Result);
+    }
+
+    return Result;
+}
+
 template <bool bCheck>
 TObjectsCollection<UObject> UObjectContainer::ResolveAllImpl(UClass* Type) const
 {
@@ -307,6 +744,48 @@ TObjectsCollection<UObject> UObjectContainer::ResolveAllImpl(UClass* Type) const
     return TObjectsCollection<UObject>(Data, TotalResolvers);
 }
 
+void UObjectContainer::ForEachResolvedImpl(UClass* Type, TFunctionRef<void(UObject*)> Visitor) const
+{
+    checkf(Type, TEXT("Requested object of null type"));
+
+    for (UObjectContainer* Container : InheritanceChain)
+    {
+        // Registrations map may reallocate if auto-registered classes are added during iteration,
+        // so we look up the resolvers list on every step instead of making a copy of it
+        for (int32 Index = 0; ; ++Index)
+        {
+            const FResolversArray* Resolvers = Container->Registrations.Find(Type);
+            if (Resolvers == nullptr || !Resolvers->IsValidIndex(Index))
+            {
+                break;
+            }
+
+            Visitor(ResolveImpl((*Resolvers)[Index], Container));
+        }
+    }
+}
+
+const UObjectContainer::FRegisteredTypes& UObjectContainer::GetRegisteredSubtypes(UClass* Type) const
+{
+    if (const FRegisteredTypes* Existing = RegisteredSubtypes.Find(Type))
+    {
+        return *Existing;
+    }
+
+    // first request for this type, collect all matching registrations once
+    FRegisteredTypes& Result = RegisteredSubtypes.Add(Type);
+
+    for (const auto& Pair : Registrations)
+    {
+        if (Pair.Key->IsChildOf(Type))
+        {
+            Result.Add(Pair.Key);
+        }
+    }
+
+    return Result;
+}
+
 void UObjectContainer::AppendInheritanceChain(TArray<UObjectContainer*>& OutChain)
 {
     if (ParentContainer != nullptr)
@@ -321,11 +800,21 @@ void UObjectContainer::AddReferencedObjects(UObject* InThis, FReferenceCollector
 {
     UObjectContainer* Container = (UObjectContainer*)InThis;
 
-    for (auto& Resolvers : Container->Registrations)
+    for (TObjectPtr<UObject>* Reference : Container->StrongReferences)
+    {
+        Collector.AddReferencedObject(*Reference);
+    }
+
+    for (UnrealDI_Impl::FLifetimeHandler* Handler : Container->CustomLifetimes)
     {
-        for (FResolver& Resolver : Resolvers.Value)
+        Handler->AddReferencedObjects(Collector);
+    }
+
+    for (FInjectionPlan* Plan : Container->MemoizingPlans)
+    {
+        if (Plan->MemoizedArguments.IsValid())
         {
-            Resolver.LifetimeHandler->AddReferencedObjects(Collector);
+            Plan->MemoizedArguments->AddReferencedObjects(Collector);
         }
     }
 
@@ -337,7 +826,111 @@ void UObjectContainer::AddReferencedObjects(UObject* InThis, FReferenceCollector
     Super::AddReferencedObjects(InThis, Collector);
 }
 
-UObject* UObjectContainer::ResolveFromContext(const UObject& Context, UClass& Type)
+void UObjectContainer::ResolveBoundFromContext(const UObject& Context, UnrealDI_Impl::FFactoryBinding& Binding, TArrayView<UObject*> OutObjects, const UnrealDI_Impl::FFactoryCallParams& Params)
+{
+    const UObjectContainer& Container = static_cast<const UObjectContainer&>(Context);
+
+    if (Binding.Generation != Container.Generation)
+    {
+        // Registrations were modified after Binding was made, find Resolver again
+        const auto [Resolver, OwningContainer] = Container.GetResolver<true>(Binding.Type);
+        check(OwningContainer == &Container);
+
+        Binding.Resolver = Resolver;
+        Binding.Generation = Container.Generation;
+    }
+
+    const FResolver& Resolver = *static_cast<const FResolver*>(Binding.Resolver);
+
+    if (Params.bRelease)
+    {
+        for (UObject* Object : OutObjects)
+        {
+            Resolver.LifetimeHandler->Release(Object);
+        }
+
+        return;
+    }
+
+    checkf(Params.Initializer == nullptr || Resolver.LifetimeHandler->IsTransient(), TEXT("TFactory with runtime arguments requires transient lifetime, but type %s has different one"), *Binding.Type->GetName());
+
+    if (OutObjects.Num() == 1)
+    {
+        OutObjects[0] = ResolveImpl(Resolver, &Container, &Params);
+    }
+    else
+    {
+        ResolveManyImpl(Resolver, &Container, OutObjects, Params);
+    }
+}
+
+TFactory<UObject> UObjectContainer::MakeBoundFactory(UClass* Type, const FResolver& Resolver) const
+{
+    UnrealDI_Impl::FFactoryBinding Binding;
+    Binding.Type = Type;
+    Binding.Resolver = &Resolver;
+    Binding.Generation = Generation;
+
+    return TFactory<UObject>(*this, &ThisClass::ResolveBoundFromContext, Binding);
+}
+
+TSharedRef<const UnrealDI_Impl::FResolveHandleData> UObjectContainer::MakeResolveHandleData(UClass* Type) const
+{
+    checkf(Type, TEXT("Requested handle of null type"));
+
+    const auto [Resolver, Container] = GetResolver<true>(Type);
+
+    // handle shares InjectionPlan with the registration. Plan also identifies the registration when checking for stale handles
+    Resolver->GetInjectionPlan();
+
+#if !UE_BUILD_SHIPPING
+    return MakeShared<UnrealDI_Impl::FResolveHandleData>(UnrealDI_Impl::FResolveHandleData{ *Resolver, Container, Type, this, Generation });
+#else
+    return MakeShared<UnrealDI_Impl::FResolveHandleData>(UnrealDI_Impl::FResolveHandleData{ *Resolver, Container });
+#endif
+}
+
+UObject* UObjectContainer::ResolveFromHandle(const UnrealDI_Impl::FResolveHandleData& Data)
+{
+#if !UE_BUILD_SHIPPING
+    const UObjectContainer* RequestingContainer = Data.RequestingContainer.Get();
+    checkf(RequestingContainer != nullptr, TEXT("TResolveHandle of type %s is used after its container was destroyed"), *Data.Type->GetName());
+
+    if (Data.Generation != RequestingContainer->Generation)
+    {
+        // Registrations were modified after handle was made, make sure it still points to the registration that Resolve would use
+        const auto [Resolver, _] = RequestingContainer->FindResolver(Data.Type);
+        // lifetime handlers may be shared between registrations, but every registration has its own injection plan. Handle created it, so it is never null here
+        checkf(Resolver != nullptr && Resolver->InjectionPlan == Data.Resolver.InjectionPlan, TEXT("TResolveHandle of type %s is stale"), *Data.Type->GetName());
+
+        Data.Generation = RequestingContainer->Generation;
+    }
+#endif
+
+    return ResolveImpl(Data.Resolver, Data.OwningContainer);
+}
+
+UObject* UObjectContainer::ResolveCachedImpl(UClass* Type, UnrealDI_Impl::FResolveInlineCache& Cache) const
+{
+    checkf(Type, TEXT("Requested object of null type"));
+
+    // Generation identifies this container, so OwningContainer is known to be alive when it matches. It is either this one or one of its parents
+    if (Cache.Generation != Generation || static_cast<const UObjectContainer*>(Cache.OwningContainer)->Generation != Cache.OwningGeneration)
+    {
+        const auto [Resolver, Container] = GetResolver<true>(Type);
+
+        // read generations after GetResolver, because it may auto register Type
+        Cache.Generation = Generation;
+        Cache.OwningGeneration = Container->Generation;
+        Cache.Resolver = Resolver;
+        Cache.OwningContainer = Container;
+    }
+
+    return ResolveImpl(*static_cast<const FResolver*>(Cache.Resolver), static_cast<const UObjectContainer*>(Cache.OwningContainer));
+}
+
+uint32 UObjectContainer::MakeUniqueGeneration()
 {
-    return static_cast<const UObjectContainer&>(Context).Resolve(&Type);
+    static std::atomic<uint32> LastGeneration = 0;
+    return ++LastGeneration;
 }
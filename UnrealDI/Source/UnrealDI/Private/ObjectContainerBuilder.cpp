@@ -2,6 +2,17 @@
 
 #include "DI/ObjectContainerBuilder.h"
 #include "DI/ObjectContainer.h"
+#include "DI/CompiledObjectContainer.h"
+#include "DI/Impl/Lifetimes.h"
+
+FObjectContainerBuilder::FConfiguratorsArena::~FConfiguratorsArena()
+{
+    // arena only releases memory, configurators must be destroyed explicitly
+    for (UnrealDI_Impl::FRegistrationConfiguratorBase* Configurator : Configurators)
+    {
+        Configurator->~FRegistrationConfiguratorBase();
+    }
+}
 
 UObjectContainer* FObjectContainerBuilder::Build(UObject* Outer)
 {
@@ -29,53 +40,64 @@ void FObjectContainerBuilder::SetOuterForNewObjects(UObject* Outer)
     OuterForNewObjects = Outer;
 }
 
-void FObjectContainerBuilder::AddRegistrationsToContainer(UObjectContainer* Container)
+TSharedRef<const FCompiledObjectContainer> FObjectContainerBuilder::Compile() const
 {
-    using namespace UnrealDI_Impl;
+    TSharedRef<FCompiledObjectContainer> Result = MakeShared<FCompiledObjectContainer>();
+    Result->OuterForNewObjects = OuterForNewObjects;
+
+    VisitRegistrations(Result->LifetimeHandlers, [&Result](UClass* Type, const TSoftClassPtr<UObject>& EffectiveClass, UnrealDI_Impl::FLifetimeHandler& LifetimeHandler, EObjectNamingPolicy NamingPolicy)
+    {
+        Result->Registrations.FindOrAdd(Type).Emplace(UObjectContainer::MakeResolver(EffectiveClass, LifetimeHandler, NamingPolicy, Result->SoftEffectiveClasses));
+    });
+
+    GatherAutoCreatedTypes(Result->AutoCreatedTypes);
 
+    return Result;
+}
+
+void FObjectContainerBuilder::AddRegistrationsToContainer(UObjectContainer* Container)
+{
     // add user provided registrations
+    VisitRegistrations(*Container->LifetimeHandlers, [Container](UClass* Type, const TSoftClassPtr<UObject>& EffectiveClass, UnrealDI_Impl::FLifetimeHandler& LifetimeHandler, EObjectNamingPolicy NamingPolicy)
+    {
+        Container->AddRegistration(Type, EffectiveClass, LifetimeHandler, NamingPolicy);
+    });
+
+    Container->AddSelfRegistrations();
+
+    GatherAutoCreatedTypes(Container->AutoCreatedTypes);
+
+    // finalize creation and let Container create its services
+    Container->FinalizeCreation();
+}
+
+void FObjectContainerBuilder::VisitRegistrations(UnrealDI_Impl::FLifetimeHandlerArena& Arena, FRegistrationVisitor Visitor) const
+{
     for (auto& Registration : Registrations)
     {
-        TSharedRef<FLifetimeHandler> LifetimeHandler = Registration->CreateLifetimeHandler();
+        UnrealDI_Impl::FLifetimeHandler& LifetimeHandler = Registration->CreateLifetimeHandler(Arena);
 
         // if no interface types declared, register as itself
         if (Registration->InterfaceTypes.Num() == 0)
         {
-            Container->AddRegistration(Registration->ImplClass, Registration->EffectiveClassPtr, LifetimeHandler);
+            Visitor(Registration->ImplClass, Registration->EffectiveClassPtr, LifetimeHandler, Registration->NamingPolicy);
         }
 
         // register all interfaces that this type implements
         for (UClass* Interface : Registration->InterfaceTypes)
         {
-            Container->AddRegistration(Interface, Registration->ImplClass, LifetimeHandler);
+            Visitor(Interface, Registration->ImplClass, LifetimeHandler, Registration->NamingPolicy);
         }
     }
+}
 
-    TSharedRef<FLifetimeHandler> ContainerInstance = MakeShared<FLifetimeHandler_Instance>(Container);
-
-    // register container itself as IResolver
-    Container->AddRegistration(UResolver::StaticClass(), UObjectContainer::StaticClass(), ContainerInstance);
-
-    // register container itself as IInjector
-    Container->AddRegistration(UInjector::StaticClass(), UObjectContainer::StaticClass(), ContainerInstance);
-
-    // register container itself as IInjectorProvider, if not customized in either self or parent
-    auto [Resolver, _] = Container->FindResolver(UInjectorProvider::StaticClass());
-    if (Resolver == nullptr || Resolver->EffectiveClass == UObjectContainer::StaticClass())
-    {
-        Container->AddRegistration(UInjectorProvider::StaticClass(), UObjectContainer::StaticClass(), ContainerInstance);
-    }
-
-    // finalize creation and let Container create its services
-    Container->FinalizeCreation();
-
-    // resolve all classes that are marked with bAutoCreate
+void FObjectContainerBuilder::GatherAutoCreatedTypes(TArray<UClass*>& OutTypes) const
+{
     for (auto& Registration : Registrations)
     {
         if (Registration->bAutoCreate)
         {
-            UClass* ClassToResolve = Registration->InterfaceTypes.Num() > 0 ? Registration->InterfaceTypes[0] : Registration->ImplClass;
-            Container->Resolve(ClassToResolve);
+            OutTypes.Add(Registration->InterfaceTypes.Num() > 0 ? Registration->InterfaceTypes[0] : Registration->ImplClass);
         }
     }
 }
@@ -7,16 +7,12 @@
 namespace UnrealDI_Impl
 {
 
-FScriptMapLayout FObjectContainerIteratorBase::MapLayout = FScriptMap::GetScriptLayout(
-    sizeof(UClass*), alignof(UClass*),
-    sizeof(UObjectContainer::FResolversArray), alignof(UObjectContainer::FResolversArray)
-);
-
 FObjectContainerIteratorBase::FObjectContainerIteratorBase(TConstArrayView<UObjectContainer*> InContainers, UClass* InClass)
     : Containers(InContainers)
     , DesiredClass(InClass)
+    , CurrentType(nullptr)
     , ContainerIndex(0)
-    , MapIndex(0)
+    , TypeIndex(0)
     , ArrayIndex(-1)
 {
     Advance();
@@ -27,10 +23,7 @@ UObject* FObjectContainerIteratorBase::Get(bool bCreateIfNotExists) const
     checkf(HasValue(), TEXT("You should not access iterator when it has no value"));
 
     const UObjectContainer* Container = Containers[ContainerIndex];
-
-    FScriptMap* Map = (FScriptMap*)&Container->Registrations;
-    auto* Pair = (TPair<UClass*, UObjectContainer::FResolversArray>*)Map->GetData(MapIndex, MapLayout);
-    const UObjectContainer::FResolver& Resolver = Pair->Value[ArrayIndex];
+    const UObjectContainer::FResolver& Resolver = Container->Registrations.FindChecked(CurrentType)[ArrayIndex];
 
     UObject* Result = Resolver.LifetimeHandler->Get();
     if (Result == nullptr && bCreateIfNotExists)
@@ -50,43 +43,34 @@ void FObjectContainerIteratorBase::Advance()
 
     ArrayIndex += 1;
 
-    while (ContainerIndex  < Containers.Num())
+    while (ContainerIndex < Containers.Num())
     {
         const UObjectContainer* Container = Containers[ContainerIndex];
-        FScriptMap* Map = (FScriptMap*)&Container->Registrations;
 
-        while (MapIndex < Map->GetMaxIndex())
-        {
-            // Map may have invalid indexes in the middle, so we skip them
-            if (!Map->IsValidIndex(MapIndex))
-            {
-                MapIndex += 1;
-                continue;
-            }
+        // visit only registered types derived from DesiredClass instead of scanning the whole Registrations map
+        const UObjectContainer::FRegisteredTypes& Types = Container->GetRegisteredSubtypes(DesiredClass);
 
-            auto* Pair = (TPair<UClass*, UObjectContainer::FResolversArray>*)Map->GetData(MapIndex, MapLayout);
-            if (ArrayIndex == 0 && !Pair->Key->IsChildOf(DesiredClass))
-            {
-                MapIndex += 1;
-                continue;
-            }
+        while (TypeIndex < Types.Num())
+        {
+            CurrentType = Types[TypeIndex];
 
-            if (Pair->Value.IsValidIndex(ArrayIndex))
+            if (Container->Registrations.FindChecked(CurrentType).IsValidIndex(ArrayIndex))
             {
                 return;
             }
 
-            MapIndex += 1;
+            TypeIndex += 1;
             ArrayIndex = 0;
         }
 
         ContainerIndex += 1;
-        MapIndex = 0;
+        TypeIndex = 0;
         ArrayIndex = 0;
     }
 
     // break iteration, make HasValue return false
-    ContainerIndex = -1;
+    ContainerIndex = INDEX_NONE;
+    CurrentType = nullptr;
 }
 
 }
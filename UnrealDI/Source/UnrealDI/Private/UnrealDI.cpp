@@ -2,6 +2,7 @@
 
 #include "Modules/ModuleManager.h"
 #include "DI/Impl/DependenciesRegistry.h"
+#include "DI/Impl/DeferredInjectionQueue.h"
 
 class FUnrealDIModuleImpl : public IModuleInterface
 {
@@ -11,12 +12,14 @@ public:
         FModuleManager::Get().OnModulesChanged().AddRaw(this, &FUnrealDIModuleImpl::RegisterDependencies);
         UnrealDI_Impl::FDependenciesRegistry::Init();
         UnrealDI_Impl::FDependenciesRegistry::ProcessPendingRegistrations();
+        UnrealDI_Impl::FDeferredInjectionQueue::Init();
     }
 
     void ShutdownModule() override
     {
         FModuleManager::Get().OnModulesChanged().RemoveAll(this);
         UnrealDI_Impl::FDependenciesRegistry::Shutdown();
+        UnrealDI_Impl::FDeferredInjectionQueue::Shutdown();
     }
 
 private:
@@ -0,0 +1,58 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "DI/Impl/WidgetPoolHolder.h"
+#include "DI/Impl/Lifetimes.h"
+#include "Blueprint/UserWidget.h"
+#include "UObject/Package.h"
+
+namespace UnrealDI_Impl
+{
+    void FLifetimeHandler_PooledWidget::AddReferencedObjectsCustom(FReferenceCollector& Collector)
+    {
+        Collector.AddReferencedObject(PoolHolder);
+    }
+
+    UObject* FLifetimeHandler_PooledWidget::Create(UObject* Outer, UClass* EffectiveClass, bool& bOutIsReused)
+    {
+        checkf(EffectiveClass->IsChildOf<UUserWidget>(), TEXT("Only UUserWidget subclasses may be registered as pooled widgets, but %s is not"), *EffectiveClass->GetName());
+
+        if (PoolHolder == nullptr)
+        {
+            UWorld* World = Outer->GetWorld();
+            checkf(World != nullptr, TEXT("Cannot retrieve World from container. Make sure you provided valid Outer to FObjectContainerBuilder::Build"));
+
+            PoolHolder = NewObject<UWidgetPoolHolder>(GetTransientPackage());
+            PoolHolder->Pool.SetWorld(World);
+        }
+
+        UUserWidget* Widget = PoolHolder->Pool.GetOrCreateInstance<UUserWidget>(EffectiveClass);
+
+        // pool hands out released widgets first, all other widgets are new
+        bOutIsReused = ReleasedWidgets.Remove(Widget) > 0;
+        return Widget;
+    }
+
+    void FLifetimeHandler_PooledWidget::Release(UObject* Object)
+    {
+        if (PoolHolder != nullptr)
+        {
+            // keep Slate widget alive, so it is reused next time
+            PoolHolder->Pool.Release(CastChecked<UUserWidget>(Object), false);
+            ReleasedWidgets.Add(Object);
+
+            // widgets destroyed while in the pool are never handed out again, drop them from time to time
+            if (ReleasedWidgets.Num() >= NextPruneNum)
+            {
+                for (auto It = ReleasedWidgets.CreateIterator(); It; ++It)
+                {
+                    if (!It->IsValid())
+                    {
+                        It.RemoveCurrent();
+                    }
+                }
+
+                NextPruneNum = FMath::Max(16, ReleasedWidgets.Num() * 2);
+            }
+        }
+    }
+}
@@ -0,0 +1,42 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/ObjectContainer.h"
+#include "DI/Impl/Lifetimes.h"
+#include "UObject/GCObject.h"
+
+/*
+ * Immutable set of registrations produced by FObjectContainerBuilder::Compile().
+ * Every Build() copies prepared registration table instead of running registrations of the builder again.
+ * Every built container gets its own copy of lifetime handlers. Registered instances are shared by all of them,
+ * per-container objects (e.g. SingleInstance) start empty in every container.
+ * Keeps registered instances and Outer for new objects alive while it exists
+ */
+class UNREALDI_API FCompiledObjectContainer : public FGCObject
+{
+public:
+    /* Same as FObjectContainerBuilder::Build */
+    UObjectContainer* Build(UObject* Outer = nullptr) const;
+
+    /* Same as FObjectContainerBuilder::BuildNested */
+    UObjectContainer* BuildNested(UObjectContainer& Parent) const;
+
+    // ~Begin FGCObject interface
+    void AddReferencedObjects(FReferenceCollector& Collector) override;
+    FString GetReferencerName() const override;
+    // ~End FGCObject interface
+
+private:
+    friend class FObjectContainerBuilder;
+
+    void AddRegistrationsToContainer(UObjectContainer* Container) const;
+
+    TMap<UClass*, UObjectContainer::FResolversArray> Registrations;
+
+    // every built container copies these handlers into its own arena, so it never depends on this table
+    UnrealDI_Impl::FLifetimeHandlerArena LifetimeHandlers;
+    UObjectContainer::FSoftClassesArray SoftEffectiveClasses;
+    TArray<UClass*> AutoCreatedTypes;
+    TObjectPtr<UObject> OuterForNewObjects = nullptr;
+};
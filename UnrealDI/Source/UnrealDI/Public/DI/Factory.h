@@ -5,17 +5,60 @@
 #include "DI/Impl/IsUInterface.h"
 #include "DI/Impl/StaticClass.h"
 #include "UObject/ScriptInterface.h"
+#include "Containers/ArrayView.h"
+#include "Templates/Function.h"
+
+struct FObjectCreationParams;
+
+namespace UnrealDI_Impl
+{
+    /*
+     * Registration captured by TFactory when it is created by a container.
+     * Contents are managed by the container and are opaque to TFactory
+     */
+    struct FFactoryBinding
+    {
+        UClass* Type = nullptr;
+        const void* Resolver = nullptr;
+        uint32 Generation = 0;
+    };
+
+    /*
+     * Optional data TFactory passes to the container along with the request
+     */
+    struct FFactoryCallParams
+    {
+        /* Called for every new object after dependencies are injected, but before its creation is finalized */
+        const TFunctionRef<void(UObject&)>* Initializer = nullptr;
+
+        /* Passed to IInstanceFactory when new object is created */
+        const FObjectCreationParams* CreationParams = nullptr;
+
+        /* When set, objects passed to the container are returned to their lifetime instead of resolving new ones */
+        bool bRelease = false;
+    };
+}
 
 /*
  * Template class to request a factory of a required type.
  * It is used instead of TFunction<T*()> and TFunction<TScriptInterface<T>()>.
  * Depending on a T it will return either T* or TScriptInterface<T>
+ *
+ * Optional TArgs are runtime arguments supplied by the caller of the factory. T must have method InitArguments(TArgs...),
+ * it is called for every new object after InitDependencies and before creation is finalized (e.g. before Actor finishes spawning).
+ * Runtime arguments can only be used with types registered with transient lifetime.
+ * Factories constructed from plain FFactoryFunctionPtr (e.g. by custom IResolver implementations) are not bound to a registration.
+ * They ignore FObjectCreationParams and call InitArguments after creation is finalized, both cases trigger an ensure
+ * Example:
+ *    TFactory<AMyProjectile, float> Factory = Resolver->ResolveFactory<AMyProjectile, float>();
+ *    AMyProjectile* Projectile = Factory(Speed);
  */
-template <typename T>
+template <typename T, typename... TArgs>
 class TFactory
 {
 public:
     using FFactoryFunctionPtr = UObject* (*)(const UObject& Context, UClass& ObjectClass);
+    using FBoundFactoryFunctionPtr = void (*)(const UObject& Context, UnrealDI_Impl::FFactoryBinding& Binding, TArrayView<UObject*> OutObjects, const UnrealDI_Impl::FFactoryCallParams& Params);
 
     TFactory() = default;
 
@@ -24,31 +67,110 @@ public:
         , FactoryFunction(FactoryFunction)
     {}
 
+    /*
+     * Constructs Factory bound to a specific registration.
+     * Such Factory does not need to search for registration on every call
+     */
+    TFactory(const UObject& Object, FBoundFactoryFunctionPtr BoundFactoryFunction, const UnrealDI_Impl::FFactoryBinding& Binding)
+        : WeakContextObject(&Object)
+        , BoundFactoryFunction(BoundFactoryFunction)
+        , Binding(Binding)
+    {}
+
     template <typename U>
     explicit TFactory(const TFactory<U>& Other)
         : WeakContextObject(Other.WeakContextObject)
         , FactoryFunction(Other.FactoryFunction)
+        , BoundFactoryFunction(Other.BoundFactoryFunction)
+        , Binding(Other.Binding)
     {}
 
     template <typename U>
     TFactory(TFactory<U>&& Other)
         : WeakContextObject(Other.WeakContextObject)
         , FactoryFunction(Other.FactoryFunction)
+        , BoundFactoryFunction(Other.BoundFactoryFunction)
+        , Binding(Other.Binding)
     {}
 
     /*
      * Resolves instance of type T. Asserts if container is no longer valid
      */
-    auto operator()() const
+    auto operator()(TArgs... Args) const
+    {
+        UE_STATIC_ASSERT_COMPLETE_TYPE(T, "Type T in TFactory<T> must be fully defined when calling operator(), not just forward declared. Are you missing an #include?");
+
+        return CreateOne(nullptr, Forward<TArgs>(Args)...);
+    }
+
+    /*
+     * Resolves instance of type T passing CreationParams to IInstanceFactory (e.g. Actor spawn transform).
+     * CreationParams are ignored if lifetime of T returns existing object. Asserts if container is no longer valid
+     */
+    auto operator()(const FObjectCreationParams& CreationParams, TArgs... Args) const
     {
         UE_STATIC_ASSERT_COMPLETE_TYPE(T, "Type T in TFactory<T> must be fully defined when calling operator(), not just forward declared. Are you missing an #include?");
 
-        checkf(FactoryFunction != nullptr, TEXT("TFactory is not initialized"));
+        return CreateOne(&CreationParams, Forward<TArgs>(Args)...);
+    }
+
+    /*
+     * Resolves Count instances of type T and appends them to OutObjects. Asserts if container is no longer valid.
+     * Registration and instance factory are looked up once for the whole batch.
+     * Transient objects are created in phases: all of them are constructed, then injected, then finalized.
+     * This means Actors are spawned deferred and finish spawning together after all of them received dependencies
+     */
+    template <typename TElement, typename TAllocator>
+    void CreateMany(int32 Count, TArray<TElement, TAllocator>& OutObjects, const TArgs&... Args) const
+    {
+        UE_STATIC_ASSERT_COMPLETE_TYPE(T, "Type T in TFactory<T> must be fully defined when calling CreateMany(), not just forward declared. Are you missing an #include?");
+
+        checkf(Count >= 0, TEXT("Count must not be negative"));
 
+        if (Count == 0)
+        {
+            return;
+        }
+
+        TArray<UObject*, TInlineAllocator<16>> Objects;
+        Objects.AddZeroed(Count);
+
+        if constexpr (sizeof...(TArgs) > 0)
+        {
+            // every object receives its own copy of runtime arguments
+            auto InitArguments = [&](UObject& NewObject) { Cast(&NewObject)->InitArguments(Args...); };
+            const TFunctionRef<void(UObject&)> Initializer(InitArguments);
+
+            CreateObjects(Objects, &Initializer, nullptr);
+        }
+        else
+        {
+            CreateObjects(Objects, nullptr, nullptr);
+        }
+
+        OutObjects.Reserve(OutObjects.Num() + Count);
+        for (UObject* Object : Objects)
+        {
+            OutObjects.Emplace(Cast(Object));
+        }
+    }
+
+    /*
+     * Returns Object created by this Factory back to the lifetime of its registration, allowing it to be reused later (e.g. pooled widgets).
+     * Does nothing for lifetimes that do not reuse objects
+     */
+    void Release(UObject* Object) const
+    {
         const UObject* ContextObject = WeakContextObject.Get();
-        checkf(ContextObject != nullptr, TEXT("TFactory invoked after UObjectContainer was destroyed"));
+        if (Object == nullptr || ContextObject == nullptr || BoundFactoryFunction == nullptr)
+        {
+            return;
+        }
+
+        UnrealDI_Impl::FFactoryCallParams Params;
+        Params.bRelease = true;
 
-        return Cast(FactoryFunction(*ContextObject, *UnrealDI_Impl::TStaticClass<T>::StaticClass()));
+        BoundFactoryFunction(*ContextObject, Binding, MakeArrayView(&Object, 1), Params);
     }
 
     /*
@@ -57,7 +179,7 @@ public:
      */
     bool IsValid() const
     {
-        return FactoryFunction != nullptr && WeakContextObject.IsValid();
+        return (FactoryFunction != nullptr || BoundFactoryFunction != nullptr) && WeakContextObject.IsValid();
     }
 
     /*
@@ -70,7 +192,58 @@ public:
     }
 
 private:
-    template<typename U> friend class TFactory;
+    template <typename U, typename... UArgs> friend class TFactory;
+
+    auto CreateOne(const FObjectCreationParams* CreationParams, TArgs&&... Args) const
+    {
+        UObject* Object = nullptr;
+
+        if constexpr (sizeof...(TArgs) > 0)
+        {
+            auto InitArguments = [&](UObject& NewObject) { Cast(&NewObject)->InitArguments(Forward<TArgs>(Args)...); };
+            const TFunctionRef<void(UObject&)> Initializer(InitArguments);
+
+            CreateObjects(MakeArrayView(&Object, 1), &Initializer, CreationParams);
+        }
+        else
+        {
+            CreateObjects(MakeArrayView(&Object, 1), nullptr, CreationParams);
+        }
+
+        return Cast(Object);
+    }
+
+    void CreateObjects(TArrayView<UObject*> OutObjects, const TFunctionRef<void(UObject&)>* Initializer, const FObjectCreationParams* CreationParams) const
+    {
+        checkf(FactoryFunction != nullptr || BoundFactoryFunction != nullptr, TEXT("TFactory is not initialized"));
+
+        const UObject* ContextObject = WeakContextObject.Get();
+        checkf(ContextObject != nullptr, TEXT("TFactory invoked after UObjectContainer was destroyed"));
+
+        UnrealDI_Impl::FFactoryCallParams Params;
+        Params.Initializer = Initializer;
+        Params.CreationParams = CreationParams;
+
+        if (BoundFactoryFunction != nullptr)
+        {
+            BoundFactoryFunction(*ContextObject, Binding, OutObjects, Params);
+            return;
+        }
+
+        // factory is not bound to registration, so FactoryFunction creates fully finalized objects and has no way to receive CreationParams
+        ensureMsgf(CreationParams == nullptr, TEXT("FObjectCreationParams are not supported by TFactory that is not bound to a registration, they are ignored"));
+        ensureMsgf(Initializer == nullptr, TEXT("TFactory that is not bound to a registration passes runtime arguments after object creation is finalized"));
+
+        for (UObject*& Object : OutObjects)
+        {
+            Object = FactoryFunction(*ContextObject, *UnrealDI_Impl::TStaticClass<T>::StaticClass());
+
+            if (Initializer != nullptr)
+            {
+                (*Initializer)(*Object);
+            }
+        }
+    }
 
     auto Cast(UObject* Object) const
     {
@@ -90,4 +263,8 @@ private:
 
     TWeakObjectPtr<const UObject> WeakContextObject;
     FFactoryFunctionPtr FactoryFunction = nullptr;
+    FBoundFactoryFunctionPtr BoundFactoryFunction = nullptr;
+
+    // updated by BoundFactoryFunction when registrations of the container change
+    mutable UnrealDI_Impl::FFactoryBinding Binding;
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "UObject/Interface.h"
+#include "Containers/ArrayView.h"
 #include "IInjector.generated.h"
 
 UINTERFACE()
@@ -23,6 +24,21 @@ public:
      */
     virtual bool Inject(UObject* Object) const = 0;
 
+    /*
+     * Injects dependencies into all Objects. Implementations may share work between objects of the same class.
+     * Returns number of Objects which registration was found in container
+     */
+    virtual int32 InjectAll(TConstArrayView<UObject*> Objects) const
+    {
+        int32 NumInjected = 0;
+        for (UObject* Object : Objects)
+        {
+            NumInjected += Inject(Object) ? 1 : 0;
+        }
+
+        return NumInjected;
+    }
+
     /*
      * Returns true if dependencies can be Injected into object of given class.
      * Returns false if given class was not registered for injection
@@ -18,4 +18,10 @@ class IInjectorProvider
 public:
     /* Returns Injector that should be used for given object */
     virtual TScriptInterface<IInjector> GetInjector(UObject* InjectTarget) const = 0;
+
+    /*
+     * Returns true if result of GetInjector depends only on class of InjectTarget.
+     * Allows callers to cache returned Injector per class instead of calling GetInjector for every object
+     */
+    virtual bool IsInjectorStablePerClass() const { return false; }
 };
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "UObject/Interface.h"
+#include "DI/ObjectCreationParams.h"
+#include "Containers/ArrayView.h"
 #include "IInstanceFactory.generated.h"
 
 UINTERFACE(MinimalApi)
@@ -31,4 +33,28 @@ public:
 
     /* Performs final initialization of created object. This method is called after InitDependencies are called on Object */
     virtual void FinalizeCreation(UObject* Object) const = 0;
+
+    /* Creates new Object using provided creation Params. By default Params are ignored and Create is called */
+    virtual UObject* CreateWithParams(UObject* Outer, UClass* EffectiveClass, const FObjectCreationParams& Params) const { return Create(Outer, EffectiveClass); }
+
+    /* Performs final initialization of object created by CreateWithParams. By default Params are ignored and FinalizeCreation is called */
+    virtual void FinalizeCreationWithParams(UObject* Object, const FObjectCreationParams& Params) const { FinalizeCreation(Object); }
+
+    /* Creates new Object for every element of OutObjects. Dependencies will be injected into all of them before FinalizeCreationMany is called */
+    virtual void CreateMany(UObject* Outer, UClass* EffectiveClass, const FObjectCreationParams& Params, TArrayView<UObject*> OutObjects) const
+    {
+        for (UObject*& Object : OutObjects)
+        {
+            Object = CreateWithParams(Outer, EffectiveClass, Params);
+        }
+    }
+
+    /* Performs final initialization of all objects created by CreateMany. Override to amortize work shared by the whole batch */
+    virtual void FinalizeCreationMany(TArrayView<UObject* const> Objects, const FObjectCreationParams& Params) const
+    {
+        for (UObject* Object : Objects)
+        {
+            FinalizeCreationWithParams(Object, Params);
+        }
+    }
 };
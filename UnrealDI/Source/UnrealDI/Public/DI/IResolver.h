@@ -10,10 +10,11 @@
 template<typename T>
 class TObjectsCollection;
 
-template <typename T>
+template <typename T, typename... TArgs>
 class TFactory;
 
 class UClass;
+struct FObjectCreationParams;
 
 UINTERFACE()
 class UNREALDI_API UResolver : public UInterface { GENERATED_BODY() };
@@ -45,6 +46,29 @@ public:
         return Resolve(UnrealDI_Impl::TStaticClass< T >::StaticClass());
     }
 
+    /*
+     * Returns instance of given Type. Asserts if Type is not registered
+     * If new object is created, Params are passed to IInstanceFactory (e.g. Actor spawn transform, owner and instigator).
+     * Default implementation ignores Params, override it if resolver supports them
+     */
+    virtual UObject* Resolve(UClass* Type, const FObjectCreationParams& Params) const { return Resolve(Type); }
+
+    /* Returns instance of given Type. If new object is created, Params are passed to IInstanceFactory */
+    template <typename T>
+    typename TEnableIf<TIsDerivedFrom<T, UObject>::Value, T*>::Type
+        Resolve(const FObjectCreationParams& Params) const
+    {
+        return (T*)Resolve(UnrealDI_Impl::TStaticClass< T >::StaticClass(), Params);
+    }
+
+    /* Returns instance of given Interface. If new object is created, Params are passed to IInstanceFactory */
+    template <typename T>
+    typename TEnableIf<UnrealDI_Impl::TIsUInterface< T >::Value, TScriptInterface< T >>::Type
+        Resolve(const FObjectCreationParams& Params) const
+    {
+        return Resolve(UnrealDI_Impl::TStaticClass< T >::StaticClass(), Params);
+    }
+
 
     /* Returns all instances of given Type. Asserts if Type is not registered */
     virtual TObjectsCollection<UObject> ResolveAll(UClass* Type) const = 0;
@@ -60,9 +84,12 @@ public:
     /* Returns Factory that can be used to resolve given Type. Asserts if Type is not registered */
     virtual TFactory<UObject> ResolveFactory(UClass* Type) const = 0;
 
-    /* Returns Factory that can be used to resolve given Type. Asserts if Type is not registered */
-    template <typename T>
-    TFactory<T> ResolveFactory() const
+    /*
+     * Returns Factory that can be used to resolve given Type. Asserts if Type is not registered
+     * Optional TArgs are runtime arguments passed to InitArguments of every created object (see TFactory)
+     */
+    template <typename T, typename... TArgs>
+    TFactory<T, TArgs...> ResolveFactory() const
     {
         return ResolveFactory(UnrealDI_Impl::TStaticClass< T >::StaticClass());
     }
@@ -103,8 +130,8 @@ public:
     virtual TFactory<UObject> TryResolveFactory(UClass* Type) const = 0;
 
     /* Returns Factory that can be used to resolve given Type if it is registered, otherwise returns invalid TFactory */
-    template <typename T>
-    TFactory<T> TryResolveFactory() const
+    template <typename T, typename... TArgs>
+    TFactory<T, TArgs...> TryResolveFactory() const
     {
         return TryResolveFactory(UnrealDI_Impl::TStaticClass< T >::StaticClass());
     }
@@ -67,17 +67,17 @@ struct TDependencyResolver
     }
 };
 
-/* TFactory<USomeClass> or TFactory<ISomeInterface> */
-template <typename T>
+/* TFactory<USomeClass, TArgs...> or TFactory<ISomeInterface, TArgs...> */
+template <typename T, typename... TArgs>
 struct TDependencyResolver
 <
-    TFactory<T>,
+    TFactory<T, TArgs...>,
     typename TEnableIf< TOr< TIsDerivedFrom< T, UObject >, UnrealDI_Impl::TIsUInterface< T > >::Value >::Type
 >
 {
-    static TFactory<T> Resolve(const IResolver& Resolver)
+    static TFactory<T, TArgs...> Resolve(const IResolver& Resolver)
     {
-        return Resolver.ResolveFactory<T>();
+        return Resolver.ResolveFactory<T, TArgs...>();
     }
 };
 
@@ -119,17 +119,17 @@ struct TDependencyResolver
     }
 };
 
-/* TOptional< TFactory<ISomeInterface> > */
-template <typename T>
+/* TOptional< TFactory<ISomeInterface, TArgs...> > */
+template <typename T, typename... TArgs>
 struct TDependencyResolver
 <
-    TOptional< TFactory<T> >,
+    TOptional< TFactory<T, TArgs...> >,
     typename TEnableIf< UnrealDI_Impl::TIsUInterface< T >::Value >::Type
 >
 {
-    static TOptional< TFactory<T> > Resolve(const IResolver& Resolver)
+    static TOptional< TFactory<T, TArgs...> > Resolve(const IResolver& Resolver)
     {
-        if(TFactory<T> Resolved = Resolver.TryResolveFactory<T>(); Resolved.IsValid())
+        if(TFactory<T, TArgs...> Resolved = Resolver.TryResolveFactory<T, TArgs...>(); Resolved.IsValid())
         {
             return { MoveTemp(Resolved) };
         }
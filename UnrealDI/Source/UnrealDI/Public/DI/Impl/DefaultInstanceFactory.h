@@ -14,4 +14,7 @@ public:
     bool IsClassSupported(UClass* EffectiveClass) const override { return true; }
     UObject* Create(UObject* Outer, UClass* EffectiveClass) const override;
     void FinalizeCreation(UObject* Object) const override;
+    UObject* CreateWithParams(UObject* Outer, UClass* EffectiveClass, const FObjectCreationParams& Params) const override;
+    void FinalizeCreationWithParams(UObject* Object, const FObjectCreationParams& Params) const override;
+    void FinalizeCreationMany(TArrayView<UObject* const> Objects, const FObjectCreationParams& Params) const override;
 };
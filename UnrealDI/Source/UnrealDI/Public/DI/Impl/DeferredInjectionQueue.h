@@ -0,0 +1,41 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Delegates/IDelegateInstance.h"
+#include "UObject/WeakObjectPtr.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UObject;
+
+namespace UnrealDI_Impl
+{
+    /*
+     * Keeps objects that were constructed outside of game thread and need injection via FInjectOnConstruction.
+     * Objects are injected on game thread in small batches every frame and all at once when async loading of a package ends,
+     * so they get their dependencies before BeginPlay.
+     */
+    class UNREALDI_API FDeferredInjectionQueue
+    {
+    public:
+        static void Init();
+        static void Shutdown();
+
+        /* Adds Object to the queue. Safe to call from any thread */
+        static void Enqueue(UObject* Object);
+
+        /* Injects all queued objects that finished loading. Must be called from game thread */
+        static void Flush();
+
+    private:
+        static bool Tick(float DeltaTime);
+        static void ProcessQueue(double TimeBudget);
+
+        static inline TQueue<TWeakObjectPtr<UObject>, EQueueMode::Mpsc> Queue;
+        static inline FTSTicker::FDelegateHandle TickerHandle;
+        static inline FDelegateHandle EndLoadPackageHandle;
+        static inline FDelegateHandle WorldInitializedActorsHandle;
+    };
+}
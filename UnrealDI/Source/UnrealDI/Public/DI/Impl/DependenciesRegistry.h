@@ -3,7 +3,9 @@
 #pragma once
 
 #include "Containers/Map.h"
+#include "Containers/BitArray.h"
 #include "Delegates/IDelegateInstance.h"
+#include "DI/Impl/MemoizedArguments.h"
 #include "UObject/WeakObjectPtr.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 
@@ -30,30 +32,59 @@ namespace UnrealDI_Impl
 
         static void FindInitFunctions(UClass* Class, FInitFunctionPtr& OutNativeInitFunction, UFunction*& OutBlueprintInitFunction);
 
+        /* Same as above, also returns variant of native init function that can reuse arguments. It is nullptr if arguments cannot be reused */
+        static void FindInitFunctions(UClass* Class, FInitFunctionPtr& OutNativeInitFunction, FMemoizedInitFunctionPtr& OutMemoizedInitFunction, UFunction*& OutBlueprintInitFunction);
+
+        /*
+         * Returns true if Class or any of its ancestors has native or Blueprint InitDependencies.
+         * After the first call for a Class the answer is read from a bit array indexed by the Class's object index. Must be called from game thread
+         */
+        static bool IsInjectable(UClass* Class);
+
+        /*
+         * Returns number that changes every time cached init functions may become outdated.
+         * Allows callers to keep their own copy of init functions and detect when they must be looked up again
+         */
+        static uint32 GetGeneration() { return Generation; }
+
         static FName MakeInitDependenciesFunctionName(UClass* Class);
 
     private:
         using FClassGetter = UClass* (*)();
 
+        struct FNativeEntry
+        {
+            FInitFunctionPtr InitFunction;
+            FMemoizedInitFunctionPtr MemoizedInitFunction;
+        };
+
         struct FUnprocessedEntry
         {
             FClassGetter ClassGetter;
-            FInitFunctionPtr InitFunction;
+            FNativeEntry NativeEntry;
         };
 
         struct FCacheEntry
         {
             FInitFunctionPtr NativeInitFunction = nullptr;
+            FMemoizedInitFunctionPtr MemoizedInitFunction = nullptr;
             UFunction* BlueprintInitFunction = nullptr;
         };
 
         static TArray<FUnprocessedEntry>& GetUnprocessedEntries();
         static FCacheEntry* AddInitFunctionsToCache(UClass* Class);
         static void PostGarbageCollect();
+        static void InvalidateDerivedCaches();
 
-        static inline TMap<UClass*, FInitFunctionPtr> NativeInitFunctions;
+        static inline TMap<UClass*, FNativeEntry> NativeInitFunctions;
         static inline TMap<TWeakObjectPtr<UClass>, FCacheEntry> CachedInitFunctions;
         static inline FDelegateHandle PostGarbageCollectHandle;
+
+        // both are indexed by GUObjectArray index of UClass. Injectable bit is meaningful only if Known bit is set
+        static inline TBitArray<> KnownClasses;
+        static inline TBitArray<> InjectableClasses;
+
+        static inline uint32 Generation = 0;
     };
 }
 
@@ -66,5 +97,6 @@ void UnrealDI_Impl::FDependenciesRegistry::ExposeDependencies()
 
     FUnprocessedEntry& Entry = UnprocessedEntries.Emplace_GetRef();
     Entry.ClassGetter = &T::StaticClass;
-    Entry.InitFunction = &TInstanceInjector<T>::Invoke;
+    Entry.NativeEntry.InitFunction = &TInstanceInjector<T>::Invoke;
+    Entry.NativeEntry.MemoizedInitFunction = TInstanceInjector<T>::GetMemoizedInvoke();
 }
@@ -4,6 +4,9 @@
 
 #include "DI/Impl/ArgumentPack.h"
 #include "DI/Impl/HasInitDependencies.h"
+#include "DI/Impl/MemoizedArguments.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
 
 class IResolver;
 
@@ -17,6 +20,8 @@ namespace UnrealDI_Impl
     template <typename T>
     struct TInitDependenciesInvoker<T, TArgumentPack<>>
     {
+        static constexpr bool bCanMemoize = false;
+
         static void Invoke(T* Self, const IResolver& Resolver);
     };
 
@@ -24,7 +29,16 @@ namespace UnrealDI_Impl
     template <typename T, typename... TArgs>
     struct TInitDependenciesInvoker<T, TArgumentPack<TArgs...>>
     {
+        // arguments may be reused only if each of them is a single object
+        static constexpr bool bCanMemoize = (TMemoizableDependency< typename TDecay<TArgs>::Type >::Value && ...);
+
         static void Invoke(T* Self, const IResolver& Resolver);
+
+        /*
+         * Calls InitDependencies with arguments stored in InOutArguments. If there are none, resolves arguments
+         * and stores them into InOutArguments when IsPermanentDependency returns true for every requested type
+         */
+        static void InvokeMemoized(T* Self, const IResolver& Resolver, TSharedPtr<FMemoizedArguments>& InOutArguments, TFunctionRef<bool(UClass*)> IsPermanentDependency);
     };
 
 
@@ -60,3 +74,42 @@ void UnrealDI_Impl::TInitDependenciesInvoker<T, UnrealDI_Impl::TArgumentPack<TAr
 {
     Self->InitDependencies(TDependencyResolverInvoker<TArgs>(Resolver)...);
 }
+
+template <typename T, typename... TArgs>
+void UnrealDI_Impl::TInitDependenciesInvoker<T, UnrealDI_Impl::TArgumentPack<TArgs...>>::InvokeMemoized(T* Self, const IResolver& Resolver, TSharedPtr<FMemoizedArguments>& InOutArguments, TFunctionRef<bool(UClass*)> IsPermanentDependency)
+{
+    static_assert(bCanMemoize, "InitDependencies has arguments that cannot be memoized");
+
+    using FArguments = TMemoizedArguments< typename TDecay<TArgs>::Type... >;
+
+    // pass copies, because InitDependencies may accept arguments by rvalue reference
+    auto CallInitDependencies = [Self](const typename TDecay<TArgs>::Type&... Values)
+    {
+        Self->InitDependencies(typename TDecay<TArgs>::Type(Values)...);
+    };
+
+    if (InOutArguments.IsValid())
+    {
+        FArguments& StoredArguments = static_cast<FArguments&>(*InOutArguments);
+        if (StoredArguments.AreValid())
+        {
+            StoredArguments.Values.ApplyAfter(CallInitDependencies);
+            return;
+        }
+
+        // some of stored objects were destroyed, resolve all of them again
+        InOutArguments.Reset();
+    }
+
+    // braced initialization keeps order of Resolve calls the same as order of arguments
+    TSharedRef<FArguments> Arguments = MakeShared<FArguments>();
+    Arguments->Values = TTuple< typename TDecay<TArgs>::Type... >{ TDependencyResolver< typename TDecay<TArgs>::Type >::Resolve(Resolver)... };
+
+    // only objects that never change may be reused. Check this after Resolve, because it may create them
+    if ((IsPermanentDependency(TMemoizableDependency< typename TDecay<TArgs>::Type >::GetClass()) && ...))
+    {
+        InOutArguments = Arguments;
+    }
+
+    Arguments->Values.ApplyAfter(CallInitDependencies);
+}
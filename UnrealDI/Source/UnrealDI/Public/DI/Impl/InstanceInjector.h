@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "DI/Impl/MemoizedArguments.h"
+
 class UObject;
 class IResolver;
 
@@ -12,6 +14,10 @@ namespace UnrealDI_Impl
     struct TInstanceInjector
     {
         static void Invoke(UObject& TargetObject, const IResolver& Resolver);
+        static void InvokeMemoized(UObject& TargetObject, const IResolver& Resolver, TSharedPtr<FMemoizedArguments>& InOutArguments, TFunctionRef<bool(UClass*)> IsPermanentDependency);
+
+        /* Returns InvokeMemoized if arguments of InitDependencies may be reused, nullptr otherwise */
+        static FMemoizedInitFunctionPtr GetMemoizedInvoke();
     };
 }
 
@@ -24,3 +30,26 @@ void UnrealDI_Impl::TInstanceInjector<TObject>::Invoke(UObject& TargetObject, co
     using Invoker = UnrealDI_Impl::TInitDependenciesInvoker<TObject, UnrealDI_Impl::TInitMethodTypologyDeducer< TObject >>;
     Invoker::Invoke((TObject*)&TargetObject, Resolver);
 }
+
+template<typename TObject>
+void UnrealDI_Impl::TInstanceInjector<TObject>::InvokeMemoized(UObject& TargetObject, const IResolver& Resolver, TSharedPtr<FMemoizedArguments>& InOutArguments, TFunctionRef<bool(UClass*)> IsPermanentDependency)
+{
+    using Invoker = UnrealDI_Impl::TInitDependenciesInvoker<TObject, UnrealDI_Impl::TInitMethodTypologyDeducer< TObject >>;
+
+    if constexpr (Invoker::bCanMemoize)
+    {
+        Invoker::InvokeMemoized((TObject*)&TargetObject, Resolver, InOutArguments, IsPermanentDependency);
+    }
+    else
+    {
+        Invoker::Invoke((TObject*)&TargetObject, Resolver);
+    }
+}
+
+template<typename TObject>
+UnrealDI_Impl::FMemoizedInitFunctionPtr UnrealDI_Impl::TInstanceInjector<TObject>::GetMemoizedInvoke()
+{
+    using Invoker = UnrealDI_Impl::TInitDependenciesInvoker<TObject, UnrealDI_Impl::TInitMethodTypologyDeducer< TObject >>;
+
+    return Invoker::bCanMemoize ? &TInstanceInjector<TObject>::InvokeMemoized : nullptr;
+}
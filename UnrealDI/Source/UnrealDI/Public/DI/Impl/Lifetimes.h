@@ -3,27 +3,171 @@
 #pragma once
 
 #include "UObject/Object.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Misc/MemStack.h"
+
+class UWidgetPoolHolder;
 
 namespace UnrealDI_Impl
 {
+    class FLifetimeHandler;
+
+    /* Owns lifetime handlers of a single container or compiled registration table. Handlers are placed one after another and destroyed together */
+    class FLifetimeHandlerArena
+    {
+    public:
+        FLifetimeHandlerArena() = default;
+        FLifetimeHandlerArena(const FLifetimeHandlerArena&) = delete;
+        FLifetimeHandlerArena& operator=(const FLifetimeHandlerArena&) = delete;
+        inline ~FLifetimeHandlerArena();
+
+        template <typename THandler, typename... TArgs>
+        THandler& Create(TArgs&&... Args)
+        {
+            THandler* Result = new (Memory.PushBytes(sizeof(THandler), alignof(THandler))) THandler(Forward<TArgs>(Args)...);
+            Handlers.Add(Result);
+            return *Result;
+        }
+
+    private:
+        FMemStackBase Memory;
+
+        // arena only releases memory, handlers must be destroyed explicitly
+        TArray<FLifetimeHandler*> Handlers;
+    };
+
+    /* Built-in lifetimes handled without virtual calls. All other lifetimes are Custom */
+    enum class ELifetimeKind : uint8
+    {
+        Transient,
+        Instance,
+        SingleInstance,
+        Custom,
+    };
+
     class FLifetimeHandler
     {
     public:
+        explicit FLifetimeHandler(ELifetimeKind InKind = ELifetimeKind::Custom)
+            : Kind(InKind)
+        {
+        }
+
         virtual ~FLifetimeHandler() = default;
 
-        virtual UObject* Get() = 0;
-        virtual void Set(UObject* Object) = 0;
-        virtual void AddReferencedObjects(FReferenceCollector& Collector) = 0;
+        UObject* Get()
+        {
+            switch (Kind)
+            {
+            case ELifetimeKind::Transient:
+                return nullptr;
+            case ELifetimeKind::Instance:
+            case ELifetimeKind::SingleInstance:
+                return HeldObject;
+            default:
+                return GetCustom();
+            }
+        }
+
+        void Set(UObject* InObject)
+        {
+            switch (Kind)
+            {
+            case ELifetimeKind::Transient:
+            case ELifetimeKind::Instance:
+                break;
+            case ELifetimeKind::SingleInstance:
+                HeldObject = InObject;
+                break;
+            default:
+                SetCustom(InObject);
+                break;
+            }
+        }
+
+        void AddReferencedObjects(FReferenceCollector& Collector)
+        {
+            switch (Kind)
+            {
+            case ELifetimeKind::Transient:
+                break;
+            case ELifetimeKind::Instance:
+            case ELifetimeKind::SingleInstance:
+                Collector.AddReferencedObject(HeldObject);
+                break;
+            default:
+                AddReferencedObjectsCustom(Collector);
+                break;
+            }
+        }
+
+        ELifetimeKind GetKind() const { return Kind; }
+
+        /* Returns storage of object that this lifetime keeps alive. nullptr if lifetime does not hold objects in it */
+        TObjectPtr<UObject>* GetHeldObjectStorage()
+        {
+            return Kind == ELifetimeKind::Instance || Kind == ELifetimeKind::SingleInstance ? &HeldObject : nullptr;
+        }
+
+        /* Whether new object must be created on every request. Such objects may be created in batches */
+        virtual bool IsTransient() const { return false; }
+
+        /*
+         * Allows lifetime to provide new object instead of IInstanceFactory. Returns nullptr if IInstanceFactory should be used.
+         * bOutIsReused must be set if returned object was created earlier and already received its dependencies
+         */
+        virtual UObject* Create(UObject* Outer, UClass* EffectiveClass, bool& bOutIsReused) { return nullptr; }
+
+        /* Called when user returns object that is no longer needed */
+        virtual void Release(UObject* Object) {}
+
+        /* Whether every request returns the same object while it is alive. Such objects may be cached for a short period of time */
+        virtual bool IsShared() const { return false; }
+
+        /* Whether object, once returned, stays the same and is kept alive for the whole lifetime of container. Such objects may be cached by container */
+        virtual bool IsPermanent() const { return false; }
+
+        /*
+         * Creates handler for a container that copies registrations from the one that owns this handler.
+         * Per-container state (e.g. object of SingleInstance) is not copied, new handler starts empty
+         */
+        virtual FLifetimeHandler& CreateForClone(FLifetimeHandlerArena& Arena) const = 0;
+
+    protected:
+        // implementation of Get, Set and AddReferencedObjects for Custom lifetimes
+        virtual UObject* GetCustom() { return nullptr; }
+        virtual void SetCustom(UObject* InObject) {}
+        virtual void AddReferencedObjectsCustom(FReferenceCollector& Collector) {}
+
+        // object held by Instance and SingleInstance lifetimes
+        TObjectPtr<UObject> HeldObject = nullptr;
+
+    private:
+        ELifetimeKind Kind;
     };
 
-    class FLifetimeHandler_Transient : public FLifetimeHandler
+    FLifetimeHandlerArena::~FLifetimeHandlerArena()
+    {
+        for (FLifetimeHandler* Handler : Handlers)
+        {
+            Handler->~FLifetimeHandler();
+        }
+    }
+
+    class UNREALDI_API FLifetimeHandler_Transient : public FLifetimeHandler
     {
     public:
-        UObject* Get() override { return nullptr; }
-        void Set(UObject* Object) override {}
-        void AddReferencedObjects(FReferenceCollector& Collector) override {}
+        FLifetimeHandler_Transient()
+            : FLifetimeHandler(ELifetimeKind::Transient)
+        {
+        }
+
+        bool IsTransient() const override { return true; }
 
-        static TSharedRef<FLifetimeHandler> Make() { return MakeShared<FLifetimeHandler_Transient>(); }
+        FLifetimeHandler& CreateForClone(FLifetimeHandlerArena& Arena) const override { return Make(Arena); }
+
+        // handler has no state, so single instance owned by the module serves all registrations of all containers
+        static FLifetimeHandler& Make(FLifetimeHandlerArena& Arena);
     };
 
     class FLifetimeHandler_StaticFactory : public FLifetimeHandler
@@ -36,9 +180,10 @@ namespace UnrealDI_Impl
         {
         }
 
-        UObject* Get() override { return Factory(); }
-        void Set(UObject* Object) override {}
-        void AddReferencedObjects(FReferenceCollector& Collector) override {}
+        FLifetimeHandler& CreateForClone(FLifetimeHandlerArena& Arena) const override { return Arena.Create<FLifetimeHandler_StaticFactory>(Factory); }
+
+    protected:
+        UObject* GetCustom() override { return Factory(); }
 
     private:
         FunctionPtr Factory;
@@ -52,9 +197,10 @@ namespace UnrealDI_Impl
         {
         }
 
-        UObject* Get() override { return Factory(); }
-        void Set(UObject* Object) override {}
-        void AddReferencedObjects(FReferenceCollector& Collector) override {}
+        FLifetimeHandler& CreateForClone(FLifetimeHandlerArena& Arena) const override { return Arena.Create<FLifetimeHandler_CustomFactory>(Factory); }
+
+    protected:
+        UObject* GetCustom() override { return Factory(); }
 
     private:
         TFunction<UObject* ()> Factory;
@@ -64,47 +210,72 @@ namespace UnrealDI_Impl
     {
     public:
         FLifetimeHandler_Instance(UObject* Instance)
-            : Instance(Instance)
+            : FLifetimeHandler(ELifetimeKind::Instance)
         {
+            HeldObject = Instance;
         }
 
-        UObject* Get() override { return Instance; }
-        void Set(UObject* Object) override {}
-        void AddReferencedObjects(FReferenceCollector& Collector) override
-        {
-            Collector.AddReferencedObject(Instance);
-        }
+        bool IsShared() const override { return true; }
+        bool IsPermanent() const override { return true; }
 
-    private:
-        TObjectPtr<UObject> Instance;
+        // registered instance is shared by all containers
+        FLifetimeHandler& CreateForClone(FLifetimeHandlerArena& Arena) const override { return Arena.Create<FLifetimeHandler_Instance>(HeldObject.Get()); }
     };
 
     class FLifetimeHandler_SingleInstance : public FLifetimeHandler
     {
     public:
-        UObject* Get() override { return Instance; }
-        void Set(UObject* Object) override { Instance = Object; }
-        void AddReferencedObjects(FReferenceCollector& Collector) override
+        FLifetimeHandler_SingleInstance()
+            : FLifetimeHandler(ELifetimeKind::SingleInstance)
         {
-            Collector.AddReferencedObject(Instance);
         }
 
-        static TSharedRef<FLifetimeHandler> Make() { return MakeShared<FLifetimeHandler_SingleInstance>(); }
+        bool IsShared() const override { return true; }
+        bool IsPermanent() const override { return true; }
 
-    private:
-        TObjectPtr<UObject> Instance = nullptr;
+        FLifetimeHandler& CreateForClone(FLifetimeHandlerArena& Arena) const override { return Make(Arena); }
+
+        static FLifetimeHandler& Make(FLifetimeHandlerArena& Arena) { return Arena.Create<FLifetimeHandler_SingleInstance>(); }
     };
 
     class FLifetimeHandler_WeakSingleInstance : public FLifetimeHandler
     {
     public:
-        UObject* Get() override { return Instance.Get(); }
-        void Set(UObject* Object) override { Instance = Object; }
-        void AddReferencedObjects(FReferenceCollector& Collector) override {}
+        bool IsShared() const override { return true; }
+
+        FLifetimeHandler& CreateForClone(FLifetimeHandlerArena& Arena) const override { return Make(Arena); }
 
-        static TSharedRef<FLifetimeHandler> Make() { return MakeShared<FLifetimeHandler_WeakSingleInstance>(); }
+        static FLifetimeHandler& Make(FLifetimeHandlerArena& Arena) { return Arena.Create<FLifetimeHandler_WeakSingleInstance>(); }
+
+    protected:
+        UObject* GetCustom() override { return Instance.Get(); }
+        void SetCustom(UObject* InObject) override { Instance = InObject; }
 
     private:
         TWeakObjectPtr<UObject> Instance = nullptr;
     };
+
+    /* New UUserWidget is taken from FUserWidgetPool on every request. Released widgets are reused together with their Slate widgets */
+    class UNREALDI_API FLifetimeHandler_PooledWidget : public FLifetimeHandler
+    {
+    public:
+        UObject* Create(UObject* Outer, UClass* EffectiveClass, bool& bOutIsReused) override;
+        void Release(UObject* Object) override;
+
+        FLifetimeHandler& CreateForClone(FLifetimeHandlerArena& Arena) const override { return Make(Arena); }
+
+        static FLifetimeHandler& Make(FLifetimeHandlerArena& Arena) { return Arena.Create<FLifetimeHandler_PooledWidget>(); }
+
+    protected:
+        void AddReferencedObjectsCustom(FReferenceCollector& Collector) override;
+
+    private:
+        TObjectPtr<UWidgetPoolHolder> PoolHolder = nullptr;
+
+        // widgets returned to the pool. They already received dependencies and are removed once the pool hands them out again
+        TSet<TWeakObjectPtr<UObject>> ReleasedWidgets;
+
+        // ReleasedWidgets is checked for destroyed widgets when it reaches this size
+        int32 NextPruneNum = 16;
+    };
 }
@@ -0,0 +1,98 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/Impl/StaticClass.h"
+#include "DI/Impl/IsUInterface.h"
+#include "Templates/Tuple.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/ScriptInterface.h"
+#include "UObject/ObjectPtr.h"
+#include "UObject/Object.h"
+#include "UObject/UObjectGlobals.h"
+
+class IResolver;
+
+namespace UnrealDI_Impl
+{
+    /* Type erased storage for arguments of InitDependencies that may be reused for next instances of the same registration */
+    struct FMemoizedArguments
+    {
+        virtual ~FMemoizedArguments() = default;
+
+        /* Reports stored objects to GC, so references to destroyed objects are cleared */
+        virtual void AddReferencedObjects(FReferenceCollector& Collector) = 0;
+
+        /* Whether every stored object is still alive and may be passed again */
+        virtual bool AreValid() const = 0;
+    };
+
+    /* Variant of native init function that stores arguments into InOutArguments or reuses arguments already stored there */
+    using FMemoizedInitFunctionPtr = void (*)(UObject& ConstructedObject, const IResolver& Container, TSharedPtr<FMemoizedArguments>& InOutArguments, TFunctionRef<bool(UClass*)> IsPermanentDependency);
+
+    /*
+     * Tells whether dependency of type T is a single object, that can be stored and passed again to another InitDependencies call.
+     * GetClass() returns type that is requested from IResolver, GetObject() and AddReferencedObject() give access to stored object
+     */
+    template <typename T, typename = void>
+    struct TMemoizableDependency
+    {
+        static constexpr bool Value = false;
+    };
+
+    /* USomeClass* */
+    template <typename T>
+    struct TMemoizableDependency<T*, typename TEnableIf< TIsDerivedFrom< T, UObject >::Value >::Type>
+    {
+        static constexpr bool Value = true;
+        static UClass* GetClass() { return TStaticClass<T>::StaticClass(); }
+        static const UObject* GetObject(const T* Value) { return Value; }
+        static void AddReferencedObject(FReferenceCollector& Collector, T*& Value) { Collector.AddReferencedObject(Value); }
+    };
+
+    /* TObjectPtr<USomeClass> */
+    template <typename T>
+    struct TMemoizableDependency<TObjectPtr<T>, typename TEnableIf< TIsDerivedFrom< T, UObject >::Value >::Type>
+    {
+        static constexpr bool Value = true;
+        static UClass* GetClass() { return TStaticClass<T>::StaticClass(); }
+        static const UObject* GetObject(const TObjectPtr<T>& Value) { return Value.Get(); }
+        static void AddReferencedObject(FReferenceCollector& Collector, TObjectPtr<T>& Value) { Collector.AddReferencedObject(Value); }
+    };
+
+    /* TScriptInterface<ISomeInterface> */
+    template <typename T>
+    struct TMemoizableDependency<TScriptInterface<T>, typename TEnableIf< TIsUInterface< T >::Value >::Type>
+    {
+        static constexpr bool Value = true;
+        static UClass* GetClass() { return TStaticClass<T>::StaticClass(); }
+        static const UObject* GetObject(const TScriptInterface<T>& Value) { return Value.GetObject(); }
+        static void AddReferencedObject(FReferenceCollector& Collector, TScriptInterface<T>& Value) { Collector.AddReferencedObject(Value.GetObjectRef()); }
+    };
+
+    template <typename... TValues>
+    struct TMemoizedArguments : FMemoizedArguments
+    {
+        TTuple<TValues...> Values;
+
+        void AddReferencedObjects(FReferenceCollector& Collector) override
+        {
+            VisitTupleElements([&Collector](auto& Value)
+            {
+                TMemoizableDependency< typename TDecay<decltype(Value)>::Type >::AddReferencedObject(Collector, Value);
+            }, Values);
+        }
+
+        bool AreValid() const override
+        {
+            bool bResult = true;
+            VisitTupleElements([&bResult](const auto& Value)
+            {
+                bResult = bResult && IsValid(TMemoizableDependency< typename TDecay<decltype(Value)>::Type >::GetObject(Value));
+            }, Values);
+
+            return bResult;
+        }
+    };
+}
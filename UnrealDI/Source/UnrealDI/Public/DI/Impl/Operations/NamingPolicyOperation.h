@@ -0,0 +1,26 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Templates/UnrealTypeTraits.h"
+#include "DI/ObjectCreationParams.h"
+
+namespace UnrealDI_Impl
+{
+namespace RegistrationOperations
+{
+    template<typename TConfigurator>
+    class TNamingPolicyOperation
+    {
+    public:
+        /* Specifies how new objects are named. Use EObjectNamingPolicy::Unique for types that are created often */
+        TConfigurator& WithNamingPolicy(EObjectNamingPolicy Policy)
+        {
+            TConfigurator& This = StaticCast<TConfigurator&>(*this);
+            This.NamingPolicy = Policy;
+
+            return This;
+        }
+    };
+}
+}
@@ -0,0 +1,35 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/Impl/Lifetimes.h"
+#include <type_traits>
+
+class UUserWidget;
+
+namespace UnrealDI_Impl
+{
+namespace RegistrationOperations
+{
+    template<typename TConfigurator, typename TImpl>
+    class TPooledWidgetOperation
+    {
+    public:
+        /*
+         * New widget is taken from FUserWidgetPool on every request. Widgets returned via TFactory::Release are reused together with their Slate widgets.
+         * Reused widgets do not receive dependencies again. Only UUserWidget subclasses are supported
+         */
+        TConfigurator& PooledWidget()
+        {
+            // registrations made via RegisterType(UClass*) are checked when widget is created.
+            // std::is_base_of works with forward declared UUserWidget, so UMG headers are not needed here
+            static_assert(std::is_base_of_v<UUserWidget, TImpl> || std::is_same_v<TImpl, UObject>, "Only UUserWidget subclasses may be registered as pooled widgets");
+
+            TConfigurator& This = StaticCast<TConfigurator&>(*this);
+            This.LifetimeHandlerFactory = &FLifetimeHandler_PooledWidget::Make;
+
+            return This;
+        }
+    };
+}
+}
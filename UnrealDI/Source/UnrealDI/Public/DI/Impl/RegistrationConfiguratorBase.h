@@ -5,6 +5,7 @@
 #include "Containers/Array.h"
 #include "Templates/SharedPointer.h"
 #include "UObject/SoftObjectPtr.h"
+#include "DI/ObjectCreationParams.h"
 
 class UClass;
 class UObject;
@@ -13,6 +14,7 @@ class FObjectContainerBuilder;
 namespace UnrealDI_Impl
 {
     class FLifetimeHandler;
+    class FLifetimeHandlerArena;
 
     class FRegistrationConfiguratorBase
     {
@@ -23,7 +25,7 @@ namespace UnrealDI_Impl
         }
 
         virtual ~FRegistrationConfiguratorBase() = default;
-        virtual TSharedRef<FLifetimeHandler> CreateLifetimeHandler() const = 0;
+        virtual FLifetimeHandler& CreateLifetimeHandler(FLifetimeHandlerArena& Arena) const = 0;
 
     protected:
         friend class ::FObjectContainerBuilder;
@@ -32,5 +34,6 @@ namespace UnrealDI_Impl
         TArray<UClass*> InterfaceTypes;
         TSoftClassPtr<UObject> EffectiveClassPtr;
         bool bAutoCreate = false;
+        EObjectNamingPolicy NamingPolicy = EObjectNamingPolicy::Default;
     };
 }
@@ -35,9 +35,9 @@ namespace UnrealDI_Impl
         friend class RegistrationOperations::TAsSelfOperation< ThisType >;
         friend class RegistrationOperations::TByInterfacesOperation< ThisType >;
 
-        TSharedRef<FLifetimeHandler> CreateLifetimeHandler() const override
+        FLifetimeHandler& CreateLifetimeHandler(FLifetimeHandlerArena& Arena) const override
         {
-            return MakeShared<UnrealDI_Impl::FLifetimeHandler_StaticFactory>(&ThisType::GetDefaultInstance);
+            return Arena.Create<UnrealDI_Impl::FLifetimeHandler_StaticFactory>(&ThisType::GetDefaultInstance);
         }
 
         static UObject* GetDefaultInstance()
@@ -36,9 +36,9 @@ namespace UnrealDI_Impl
         friend class RegistrationOperations::TAsSelfOperation< ThisType >;
         friend class RegistrationOperations::TByInterfacesOperation< ThisType >;
 
-        TSharedRef<FLifetimeHandler> CreateLifetimeHandler() const override
+        FLifetimeHandler& CreateLifetimeHandler(FLifetimeHandlerArena& Arena) const override
         {
-            return MakeShared<UnrealDI_Impl::FLifetimeHandler_Instance>(Instance);
+            return Arena.Create<UnrealDI_Impl::FLifetimeHandler_Instance>(Instance);
         }
 
         TObject* Instance;
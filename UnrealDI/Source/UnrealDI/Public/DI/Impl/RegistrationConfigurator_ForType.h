@@ -9,6 +9,8 @@
 #include "DI/Impl/Operations/SingleInstanceOperation.h"
 #include "DI/Impl/Operations/WeakSingleInstanceOperation.h"
 #include "DI/Impl/Operations/FromBlueprintOperation.h"
+#include "DI/Impl/Operations/NamingPolicyOperation.h"
+#include "DI/Impl/Operations/PooledWidgetOperation.h"
 #include "UObject/Interface.h"
 #include "Templates/UnrealTypeTraits.h"
 
@@ -25,13 +27,15 @@ namespace UnrealDI_Impl
         , public RegistrationOperations::TSingleInstanceOperation< ThisType >
         , public RegistrationOperations::TWeakSingleInstanceOperation< ThisType >
         , public RegistrationOperations::TFromBlueprintOperation< ThisType, TObject >
+        , public RegistrationOperations::TNamingPolicyOperation< ThisType >
+        , public RegistrationOperations::TPooledWidgetOperation< ThisType, TObject >
     {
     public:
         // warn user if he tries to register UInterface boilerplate class instead of actual implementation
         static_assert(!TIsDerivedFrom<TObject, UInterface>::Value, "You are trying to register UInterface derived class. This is probably a typo");
 
         using ImplType = TObject;
-        using FLifetimeHandlerFactory = TSharedRef<FLifetimeHandler>(*)();
+        using FLifetimeHandlerFactory = FLifetimeHandler&(*)(FLifetimeHandlerArena&);
 
         TRegistrationConfigurator_ForType(const TRegistrationConfigurator_ForType&) = delete;
         TRegistrationConfigurator_ForType(TRegistrationConfigurator_ForType&&) = default;
@@ -54,10 +58,12 @@ namespace UnrealDI_Impl
         friend class RegistrationOperations::TSingleInstanceOperation< ThisType >;
         friend class RegistrationOperations::TWeakSingleInstanceOperation< ThisType >;
         friend class RegistrationOperations::TFromBlueprintOperation< ThisType, TObject >;
+        friend class RegistrationOperations::TNamingPolicyOperation< ThisType >;
+        friend class RegistrationOperations::TPooledWidgetOperation< ThisType, TObject >;
 
-        TSharedRef<FLifetimeHandler> CreateLifetimeHandler() const override
+        FLifetimeHandler& CreateLifetimeHandler(FLifetimeHandlerArena& Arena) const override
         {
-            return LifetimeHandlerFactory();
+            return LifetimeHandlerFactory(Arena);
         }
 
         FLifetimeHandlerFactory LifetimeHandlerFactory;
@@ -0,0 +1,19 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Blueprint/UserWidgetPool.h"
+#include "WidgetPoolHolder.generated.h"
+
+/*
+ * Keeps FUserWidgetPool used by pooled widget registrations and protects pooled widgets from GC
+ */
+UCLASS(Transient)
+class UNREALDI_API UWidgetPoolHolder : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(Transient)
+    FUserWidgetPool Pool;
+};
@@ -7,10 +7,18 @@
 class UWorld;
 class UObjectContainer;
 
+namespace UnrealDI_Impl
+{
+    class FDeferredInjectionQueue;
+}
+
 /*
  * Base class for objects that need injection from World-bound container when the object is constructed.
  * You must call TryInitDependencies(this) in constructor of derived class.
  * You also need to register container with you World using FInjectOnConstruction::SetContainerForWorld()
+ * Container and its IInjectorProvider are looked up once per World and cached until container is set or cleared again.
+ * Objects whose class has neither native nor Blueprint InitDependencies are skipped without looking up the container.
+ * Objects constructed outside of game thread (e.g. by async loading) are injected later on game thread, but before BeginPlay.
  */
 class UNREALDI_API FInjectOnConstruction
 {
@@ -32,6 +40,7 @@ public:
 
 protected:
     friend class UUnrealDIBlueprintLibrary; // needs access to TryInitDependenciesInternal
+    friend class UnrealDI_Impl::FDeferredInjectionQueue; // needs access to TryInitDependenciesInternal
 
     /*
      * Call this method from your subclass constructor.
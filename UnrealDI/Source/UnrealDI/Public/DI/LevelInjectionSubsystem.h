@@ -0,0 +1,59 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "LevelInjectionSubsystem.generated.h"
+
+class ULevel;
+class UObjectContainer;
+
+/*
+ * Injects dependencies into all Actors and Components of a Level in one batch, using container assigned by FInjectOnConstruction::SetContainerForWorld.
+ * All visible levels are injected when World begins play, levels streamed in later are injected before their Actors are initialized.
+ * Disabled by default. Enable it in DefaultGame.ini:
+ *
+ *   [/Script/UnrealDI.LevelInjectionSubsystem]
+ *   bEnabled=True
+ *
+ * Actors and Components created by a container before World begins play already have their dependencies and are skipped.
+ * Classes injected this way should not call FInjectOnConstruction::TryInitDependencies, otherwise they will be injected twice
+ */
+UCLASS(Config = Game)
+class UNREALDI_API ULevelInjectionSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Injects dependencies into all Actors and their Components in a Level that have InitDependencies.
+     * Returns number of injected objects
+     */
+    static int32 InjectLevel(ULevel* Level);
+
+    // ~Begin UWorldSubsystem interface
+    bool ShouldCreateSubsystem(UObject* Outer) const override;
+    void Initialize(FSubsystemCollectionBase& Collection) override;
+    void Deinitialize() override;
+    void OnWorldBeginPlay(UWorld& InWorld) override;
+    // ~End UWorldSubsystem interface
+
+protected:
+    bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    static int32 InjectLevelImpl(ULevel* Level, const TSet<FObjectKey>& SkippedObjects);
+
+    void OnPreLevelAddedToWorld(ULevel* Level, UWorld* World);
+    void OnObjectInjected(UObject& Object, const UObjectContainer& Container);
+
+    UPROPERTY(Config)
+    bool bEnabled = false;
+
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle ObjectInjectedHandle;
+
+    // Actors and Components of this World injected by containers before it began play. Not needed afterwards
+    TSet<FObjectKey> InjectedBeforeBeginPlay;
+};
@@ -6,6 +6,10 @@
 #include "IInjector.h"
 #include "IInjectorProvider.h"
 #include "DI/ObjectContainerIterator.h"
+#include "DI/ObjectCreationParams.h"
+#include "DI/ResolveHandle.h"
+#include "Templates/Function.h"
+#include "Templates/UniquePtr.h"
 #include "ObjectContainer.generated.h"
 
 class IInstanceFactory;
@@ -13,7 +17,11 @@ class IInstanceFactory;
 namespace UnrealDI_Impl
 {
     class FLifetimeHandler;
+    class FLifetimeHandlerArena;
     class FObjectContainerIteratorBase;
+    struct FFactoryBinding;
+    struct FMemoizedArguments;
+    struct FFactoryCallParams;
 }
 
 /*
@@ -36,8 +44,12 @@ class UNREALDI_API UObjectContainer : public UObject, public IResolver, public I
     GENERATED_BODY()
 
 public:
+    UObjectContainer();
+    ~UObjectContainer();
+
     // ~Begin IResolver interface
     UObject* Resolve(UClass* Type) const override;
+    UObject* Resolve(UClass* Type, const FObjectCreationParams& Params) const override;
     TObjectsCollection<UObject> ResolveAll(UClass* Type) const override;
     TFactory<UObject> ResolveFactory(UClass* Type) const override;
     UObject* TryResolve(UClass* Type) const override;
@@ -57,11 +69,13 @@ public:
 
     // ~Begin IInjector interface
     bool Inject(UObject* Object) const override;
+    int32 InjectAll(TConstArrayView<UObject*> Objects) const override;
     bool CanInject(UClass* Class) const override;
     // ~End IInjector interface
 
     // ~Begin IInjectorProvider interface
     TScriptInterface<IInjector> GetInjector(UObject* InjectTarget) const override;
+    bool IsInjectorStablePerClass() const override { return true; }
     // ~End IInjectorProvider interface
 
     /*
@@ -77,33 +91,177 @@ public:
             TObjectContainerIterator<T>(MakeConstArrayView(InheritanceChain).Right(1));
     }
 
+    /*
+     * Returns handle that resolves objects of type T without searching for registration every time.
+     * Useful for systems that resolve the same types very often.
+     * T may be either subclass of UObject or IInterface. Fails if T is not registered and may not be auto registered
+     */
+    template <typename T>
+    TResolveHandle<T> GetHandle() const
+    {
+        UE_STATIC_ASSERT_COMPLETE_TYPE(T, "Type T in GetHandle<T> must be fully defined, not just forward declared. Are you missing an #include?");
+
+        return TResolveHandle<T>(MakeResolveHandleData(UnrealDI_Impl::TStaticClass< T >::StaticClass()), &ThisClass::ResolveFromHandle);
+    }
+
+    /*
+     * Same as Resolve<T>(), but remembers found registration in Cache.
+     * Next call with the same Cache skips registration lookup if it is made on the same container and registrations did not change.
+     * Prefer UNREALDI_RESOLVE_CACHED macro, it provides separate Cache for every call site
+     */
+    template <typename T>
+    auto ResolveCached(UnrealDI_Impl::FResolveInlineCache& Cache) const
+    {
+        UE_STATIC_ASSERT_COMPLETE_TYPE(T, "Type T in ResolveCached<T> must be fully defined, not just forward declared. Are you missing an #include?");
+
+        UObject* Result = ResolveCachedImpl(UnrealDI_Impl::TStaticClass< T >::StaticClass(), Cache);
+
+        if constexpr (TIsDerivedFrom< T, UObject >::Value)
+        {
+            return (T*)Result;
+        }
+        else
+        {
+            return TScriptInterface< T >(Result);
+        }
+    }
+
+    /*
+     * Creates new container with the same registrations and the same parent, without running FObjectContainerBuilder again.
+     * Registrations that keep per-container objects (e.g. SingleInstance) start empty in the clone, all others are shared with this container.
+     * Registered instances are shared, and clone resolves IResolver, IInjector and IInjectorProvider to itself.
+     * Outer is used the same way as in FObjectContainerBuilder::Build. If no Outer is given, Outer of this container is used
+     */
+    UObjectContainer* Clone(UObject* Outer = nullptr) const;
+
+    /*
+     * Resolves all objects registered as T and passes each of them to Visitor without allocating a collection.
+     * T may be either subclass of UObject or IInterface. Visitor receives T* or TScriptInterface<T> respectively.
+     * Objects from parent containers are visited first. Does nothing if T is not registered
+     * Example:
+     *    Container->ForEachResolved<IMyListener>([](TScriptInterface<IMyListener> Listener) { Listener->Notify(); });
+     */
+    template <typename T, typename TVisitor>
+    void ForEachResolved(TVisitor&& Visitor) const
+    {
+        UE_STATIC_ASSERT_COMPLETE_TYPE(T, "Type T in ForEachResolved<T> must be fully defined, not just forward declared. Are you missing an #include?");
+
+        ForEachResolvedImpl(UnrealDI_Impl::TStaticClass< T >::StaticClass(), [&Visitor](UObject* Object)
+        {
+            if constexpr (TIsDerivedFrom< T, UObject >::Value)
+            {
+                Visitor((T*)Object);
+            }
+            else
+            {
+                Visitor(TScriptInterface< T >(Object));
+            }
+        });
+    }
+
 private:
     friend class FObjectContainerBuilder;
+    friend class FCompiledObjectContainer;
     friend class FInjectOnConstruction;
     friend class UnrealDI_Impl::FObjectContainerIteratorBase;
+    friend struct UnrealDI_Impl::FResolveHandleData;
+
+    struct FBlueprintInitArgument
+    {
+        UClass* Type;
+        bool bIsInterface;
+    };
+
+    using FBlueprintInitArguments = TArray<FBlueprintInitArgument, TInlineAllocator<8>>;
+    using FNativeInitFunctionPtr = void (*)(UObject& ConstructedObject, const IResolver& Container);
+    using FMemoizedInitFunctionPtr = void (*)(UObject& ConstructedObject, const IResolver& Container, TSharedPtr<UnrealDI_Impl::FMemoizedArguments>& InOutArguments, TFunctionRef<bool(UClass*)> IsPermanentDependency);
+
+    // init functions of a class together with everything needed to invoke them
+    struct FInjectionPlan
+    {
+        // looks up init functions again if Class differs from the bound one or registry cache was invalidated since last call
+        void Bind(UClass* InClass);
+
+        UClass* Class = nullptr;
+        uint32 RegistryGeneration = 0;
+        FNativeInitFunctionPtr NativeInitFunction = nullptr;
+        FMemoizedInitFunctionPtr MemoizedInitFunction = nullptr;
+        UFunction* BlueprintInitFunction = nullptr;
+        FBlueprintInitArguments BlueprintArguments;
+
+        // arguments of native init function, stored if all of them are permanent objects. Valid while container Generation matches
+        TSharedPtr<UnrealDI_Impl::FMemoizedArguments> MemoizedArguments;
+        uint32 ContainerGeneration = 0;
+
+        // whether plan was added to MemoizingPlans of the container
+        bool bReportsArguments = false;
+    };
 
     struct FResolver
     {
-        TSoftClassPtr<UObject> EffectiveClass;
-        TSharedRef<UnrealDI_Impl::FLifetimeHandler> LifetimeHandler;
+        // effective class if it is native, such classes are never unloaded. Otherwise nullptr and class is taken from SoftEffectiveClasses
+        UClass* NativeClass;
+        int32 SoftClassIndex;
+        EObjectNamingPolicy NamingPolicy;
+
+        // owned by LifetimeHandlers of the container (or compiled table) that holds this registration. Never moves while it is alive
+        UnrealDI_Impl::FLifetimeHandler* LifetimeHandler;
+
+        // created and bound when the first object is created, so registrations that never create objects do not allocate it.
+        // Kept on heap, so it survives Registrations reallocation and is shared with copies of FResolver made after it was created
+        mutable TSharedPtr<FInjectionPlan> InjectionPlan;
+
+        FInjectionPlan& GetInjectionPlan() const;
     };
 
-    void AddRegistration(UClass* Interface, TSoftClassPtr<UObject> EffectiveClass, const TSharedRef< UnrealDI_Impl::FLifetimeHandler >& Lifetime);
+    using FResolversArray = TArray<FResolver, TInlineAllocator<2>>;
+    using FRegisteredTypes = TArray<UClass*>;
+    using FSoftClassesArray = TArray<TSoftClassPtr<UObject>>;
+
+    // stores EffectiveClass in OutSoftClasses only if it is not a native class
+    static FResolver MakeResolver(const TSoftClassPtr<UObject>& EffectiveClass, UnrealDI_Impl::FLifetimeHandler& Lifetime, EObjectNamingPolicy NamingPolicy, FSoftClassesArray& OutSoftClasses);
+    UClass* LoadEffectiveClass(const FResolver& Resolver) const;
+
+    void AddRegistration(UClass* Interface, TSoftClassPtr<UObject> EffectiveClass, UnrealDI_Impl::FLifetimeHandler& Lifetime, EObjectNamingPolicy NamingPolicy = EObjectNamingPolicy::Default);
+    FResolversArray& AddResolver(UClass* Type, FResolver&& Resolver);
+    void AddSelfRegistrations();
+    void TrackLifetimeReferences(UnrealDI_Impl::FLifetimeHandler& Handler);
     void FinalizeCreation();
 
+    // replaces Registrations with Source. Lifetime handlers are copied into LifetimeHandlers without their per-container state and injection plans are recreated. Registrations of SourceContainer itself are rebound to this container
+    void CopyRegistrations(const TMap<UClass*, FResolversArray>& Source, const FSoftClassesArray& SourceSoftClasses, const UObjectContainer* SourceContainer);
+
     template <bool bCheck>
     TTuple<const FResolver*, const UObjectContainer*> GetResolver(UClass* Type) const;
     TTuple<const FResolver*, const UObjectContainer*> FindResolver(UClass* Type) const;
     IInstanceFactory* FindInstanceFactory(UClass* Type) const;
-    static UObject* ResolveImpl(const FResolver& Resolver, const UObjectContainer* OwningContainer);
+    static UObject* ResolveImpl(const FResolver& Resolver, const UObjectContainer* OwningContainer, const UnrealDI_Impl::FFactoryCallParams* Params = nullptr);
+    static void ResolveManyImpl(const FResolver& Resolver, const UObjectContainer* OwningContainer, TArrayView<UObject*> OutObjects, const UnrealDI_Impl::FFactoryCallParams& Params);
+    template <bool bCheck>
+    UObject* ResolveSingleImpl(UClass* Type) const;
     template <bool bCheck>
     TObjectsCollection<UObject> ResolveAllImpl(UClass* Type) const;
+    void ForEachResolvedImpl(UClass* Type, TFunctionRef<void(UObject*)> Visitor) const;
+    const FRegisteredTypes& GetRegisteredSubtypes(UClass* Type) const;
 
     void AppendInheritanceChain(TArray<UObjectContainer*>& OutChain);
 
+    bool InjectWithPlan(UObject& Object, FInjectionPlan& Plan, bool bReuseArguments = false) const;
+    static void GatherBlueprintInitArguments(UFunction& Function, FBlueprintInitArguments& OutArguments);
+    void InvokeBlueprintInitFunction(UObject& Object, UFunction& Function, TConstArrayView<FBlueprintInitArgument> Arguments) const;
+
     static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 
-    static UObject* ResolveFromContext(const UObject& Context, UClass& Type);
+    UObject* ResolveCachedImpl(UClass* Type, UnrealDI_Impl::FResolveInlineCache& Cache) const;
+
+    // returns value that was never used by any container before
+    static uint32 MakeUniqueGeneration();
+
+    static void ResolveBoundFromContext(const UObject& Context, UnrealDI_Impl::FFactoryBinding& Binding, TArrayView<UObject*> OutObjects, const UnrealDI_Impl::FFactoryCallParams& Params);
+    TFactory<UObject> MakeBoundFactory(UClass* Type, const FResolver& Resolver) const;
+
+    TSharedRef<const UnrealDI_Impl::FResolveHandleData> MakeResolveHandleData(UClass* Type) const;
+    static UObject* ResolveFromHandle(const UnrealDI_Impl::FResolveHandleData& Data);
 
     UPROPERTY()
     TObjectPtr<UObject> OuterForNewObjects = nullptr;
@@ -111,10 +269,47 @@ private:
     UPROPERTY()
     TObjectPtr<UObjectContainer> ParentContainer = nullptr;
 
-    using FResolversArray = TArray<FResolver, TInlineAllocator<2>>;
     TMap<UClass*, FResolversArray> Registrations;
 
+    // lifetime handlers of Registrations, allocated together and freed with the container
+    TUniquePtr<UnrealDI_Impl::FLifetimeHandlerArena> LifetimeHandlers;
+
+    // effective classes of registrations that may be unloaded (e.g. blueprints). Kept apart, so FResolver stays small
+    FSoftClassesArray SoftEffectiveClasses;
+
+    // maps requested type to all types in Registrations derived from it. Filled lazily by iterators
+    mutable TMap<UClass*, FRegisteredTypes> RegisteredSubtypes;
+
+    // changes every time Registrations are modified. Allows bound factories to detect that their Resolver pointer is no longer valid.
+    // Unique among all containers, so inline caches may identify both container and state of its Registrations by this value alone
+    uint32 Generation = MakeUniqueGeneration();
+
+    // shared objects resolved while InjectAll is running. nullptr outside of InjectAll
+    mutable TMap<UClass*, UObject*>* BatchResolveCache = nullptr;
+
     TArray<TScriptInterface<IInstanceFactory>, TInlineAllocator<4>> InstanceFactories;
 
+    // storage of objects held by Instance and SingleInstance lifetimes. Lets GC visit only held objects instead of every registration.
+    // Points into lifetime handlers, so GC clears the handler itself when held object is destroyed
+    TArray<TObjectPtr<UObject>*> StrongReferences;
+
+    // lifetimes that report their references by themselves
+    TArray<UnrealDI_Impl::FLifetimeHandler*> CustomLifetimes;
+
+    // plans that stored arguments of InitDependencies. Their arguments are reported to GC, so destroyed objects are never passed again
+    mutable TArray<FInjectionPlan*> MemoizingPlans;
+
+    // types resolved when container creation is finalized. Kept to do the same for clones
+    TArray<UClass*> AutoCreatedTypes;
+
     TArray<UObjectContainer*> InheritanceChain; // container chain starting from most parent to this one
 };
+
+/*
+ * Resolves object of Type from Container, keeping separate inline cache of registration for this call site.
+ * Repeated calls on the same container cost a comparison instead of registration lookup
+ * Example:
+ *    TScriptInterface<IDamageService> DamageService = UNREALDI_RESOLVE_CACHED(Container, IDamageService);
+ */
+#define UNREALDI_RESOLVE_CACHED(Container, Type) \
+    (Container)->template ResolveCached<Type>([]() -> UnrealDI_Impl::FResolveInlineCache& { static UnrealDI_Impl::FResolveInlineCache Cache; return Cache; }())
@@ -4,6 +4,8 @@
 
 #include "Templates/Function.h"
 #include "Containers/Array.h"
+#include "Misc/MemStack.h"
+#include "Templates/SharedPointer.h"
 #include "DI/Impl/RegistrationConfigurator_ForType.h"
 #include "DI/Impl/RegistrationConfigurator_ForInstance.h"
 #include "DI/Impl/RegistrationConfigurator_ForFactory.h"
@@ -11,6 +13,7 @@
 
 class UObject;
 class UObjectContainer;
+class FCompiledObjectContainer;
 class UGameInstance;
 class UWorld;
 
@@ -86,23 +89,53 @@ public:
      */
     UObjectContainer* BuildNested(UObjectContainer& Parent);
 
+    /*
+     * Creates immutable set of all registered types. It builds any number of containers without running registrations of this builder again.
+     * Builder may be modified or destroyed afterwards, result does not depend on it
+     */
+    TSharedRef<const FCompiledObjectContainer> Compile() const;
+
     /*
      * Overrides Outer for objects created by container. By default they are created in the same Outer as Container
      */
     void SetOuterForNewObjects(UObject* Outer);
 
 private:
+    // configurators are placed one after another and destroyed together with the last builder that refers to them
+    struct FConfiguratorsArena
+    {
+        ~FConfiguratorsArena();
+
+        FMemStackBase Memory;
+        TArray<UnrealDI_Impl::FRegistrationConfiguratorBase*> Configurators;
+    };
+
     template<typename TConfigurator, typename... TArgs>
     TConfigurator& AddConfigurator(TArgs... Args)
     {
-        TSharedRef<TConfigurator> Ret = MakeShared<TConfigurator>(Args...);
-        Registrations.Emplace(StaticCastSharedRef< UnrealDI_Impl::FRegistrationConfiguratorBase >(Ret));
+        if (!ConfiguratorsArena.IsValid())
+        {
+            ConfiguratorsArena = MakeShared<FConfiguratorsArena>();
+        }
+
+        TConfigurator* Ret = new (ConfiguratorsArena->Memory.PushBytes(sizeof(TConfigurator), alignof(TConfigurator))) TConfigurator(Args...);
+        ConfiguratorsArena->Configurators.Add(Ret);
+        Registrations.Add(Ret);
         return *Ret;
     }
 
+    using FRegistrationVisitor = TFunctionRef<void(UClass* Type, const TSoftClassPtr<UObject>& EffectiveClass, UnrealDI_Impl::FLifetimeHandler& LifetimeHandler, EObjectNamingPolicy NamingPolicy)>;
+
     void AddRegistrationsToContainer(UObjectContainer* Container);
+    void VisitRegistrations(UnrealDI_Impl::FLifetimeHandlerArena& Arena, FRegistrationVisitor Visitor) const;
+    void GatherAutoCreatedTypes(TArray<UClass*>& OutTypes) const;
+
+    // copies of the builder share already added configurators, same as they did when every configurator was reference counted.
+    // Created with the first registration
+    TSharedPtr<FConfiguratorsArena> ConfiguratorsArena;
 
-    TArray<TSharedRef<UnrealDI_Impl::FRegistrationConfiguratorBase>> Registrations;
+    // configurators added to this builder, in order of registration
+    TArray<UnrealDI_Impl::FRegistrationConfiguratorBase*> Registrations;
 
     UObject* OuterForNewObjects = nullptr;
 };
@@ -17,6 +17,9 @@ public:
     /** Callback after dependencies have been injected into the object, but before finalization (e.g. AActor::FinishSpawning). */
     static UNREALDI_API FOnObjectCreated OnObjectInjectedDelegate;
 
-    /** Callback when the object is fully created and ready (construction + injection + finalization completed). */
+    /**
+     * Callback when the object is fully created and ready (construction + injection + finalization completed).
+     * Also called when a pooled widget is reused. Reused widgets do not trigger OnObjectConstructedDelegate and OnObjectInjectedDelegate again.
+     */
     static UNREALDI_API FOnObjectCreated OnObjectCreatedDelegate;
 };
@@ -4,7 +4,7 @@
 
 #include "DI/Impl/IsUInterface.h"
 #include "DI/Impl/StaticClass.h"
-#include "Containers/Map.h"
+#include "Containers/ArrayView.h"
 
 class UObject;
 class UClass;
@@ -26,12 +26,12 @@ namespace UnrealDI_Impl
         void Advance();
 
     private:
-        static FScriptMapLayout MapLayout;
         TConstArrayView<UObjectContainer*> Containers;
         UClass* DesiredClass;
-        int16 ContainerIndex;
-        int16 MapIndex;
-        int16 ArrayIndex;
+        UClass* CurrentType;
+        int32 ContainerIndex;
+        int32 TypeIndex;
+        int32 ArrayIndex;
     };
 }
 
@@ -0,0 +1,34 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/ObjectContainer.h"
+#include "Async/ParallelFor.h"
+
+/*
+ * Calls Function for each already created object of class T registered in the Container, distributing calls among ParallelFor workers.
+ * Objects are collected on calling thread before any worker starts, new objects are never created.
+ * Function is called concurrently, so it must not modify the Container or objects shared between calls.
+ * @param Container - Container which objects should be visited
+ * @param Function - callable that accepts T* or TScriptInterface<T>
+ * @param Flags - Select which objects should be visited
+ */
+template <typename T, typename TFunction>
+void ParallelForEachExisting(const UObjectContainer& Container, TFunction&& Function, EObjectContainerIteratorFlags Flags = EObjectContainerIteratorFlags::None)
+{
+    using FObjectType = decltype(Container.CreateIterator<T>().Get());
+
+    TArray<FObjectType, TInlineAllocator<64>> Objects;
+    for (TObjectContainerIterator<T> It = Container.CreateIterator<T>(Flags); It; ++It)
+    {
+        if (FObjectType Object = It.Get(false))
+        {
+            Objects.Add(MoveTemp(Object));
+        }
+    }
+
+    ParallelFor(Objects.Num(), [&Objects, &Function](int32 Index)
+    {
+        Function(Objects[Index]);
+    });
+}
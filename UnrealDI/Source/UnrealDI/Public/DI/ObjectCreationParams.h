@@ -0,0 +1,57 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Math/Transform.h"
+
+class UObject;
+class AActor;
+class APawn;
+
+// declared in Engine/EngineTypes.h, which is too heavy to include here
+enum class ESpawnActorCollisionHandlingMethod : uint8;
+
+/*
+ * Controls how new objects are named by UDefaultInstanceFactory. Does not affect Actors and Widgets
+ */
+enum class EObjectNamingPolicy : uint8
+{
+    /* Use naming policy of the registration. Treated as Stable if registration does not specify it */
+    Default,
+
+    /* Give object the name of its class if it is not taken yet, otherwise fallback to unique name.
+     * Requires search for existing object on every creation */
+    Stable,
+
+    /* Always give object unique name based on class counter. Skips search for existing object, preferred for frequently created types */
+    Unique,
+};
+
+/*
+ * Optional parameters used by IInstanceFactory when new object is created.
+ * Actor specific parameters are ignored for other classes
+ * Example:
+ *    FObjectCreationParams Params;
+ *    Params.SpawnTransform = SpawnPoint->GetActorTransform();
+ *    AMyActor* Actor = Resolver->Resolve<AMyActor>(Params);
+ */
+struct FObjectCreationParams
+{
+    /* Outer for new object. When nullptr, Outer of the container is used. Pass ULevel to spawn Actor into that level */
+    UObject* Outer = nullptr;
+
+    /* Transform of spawned Actor. Identity by default */
+    FTransform SpawnTransform;
+
+    /* Owner of spawned Actor */
+    AActor* Owner = nullptr;
+
+    /* Instigator of spawned Actor */
+    APawn* Instigator = nullptr;
+
+    /* How to handle collisions at spawn point. Zero value is Undefined, which means Actor's own setting is used */
+    ESpawnActorCollisionHandlingMethod CollisionHandlingOverride = {};
+
+    /* How to name new object. Default means registration decides */
+    EObjectNamingPolicy NamingPolicy = EObjectNamingPolicy::Default;
+};
@@ -0,0 +1,75 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "DI/Impl/IsUInterface.h"
+#include "UObject/ScriptInterface.h"
+#include "Templates/SharedPointer.h"
+
+namespace UnrealDI_Impl
+{
+    /* Registration captured by TResolveHandle. Contents are managed by the container and are opaque to TResolveHandle */
+    struct FResolveHandleData;
+
+    /*
+     * Registration remembered by UObjectContainer::ResolveCached for a single call site.
+     * Contents are managed by the container. Zero Generation means cache is empty
+     */
+    struct FResolveInlineCache
+    {
+        uint32 Generation = 0;
+        uint32 OwningGeneration = 0;
+        const void* Resolver = nullptr;
+        const UObject* OwningContainer = nullptr;
+    };
+}
+
+/*
+ * Handle to a registration of type T obtained once from UObjectContainer::GetHandle<T>().
+ * Resolve() returns the same object as UObjectContainer::Resolve<T>() would, but skips searching for registration.
+ * Handle must not outlive the container it was obtained from
+ * Example:
+ *    TResolveHandle<IDamageService> DamageServiceHandle = Container->GetHandle<IDamageService>();
+ *    ...
+ *    DamageServiceHandle.Resolve()->ApplyDamage(...);
+ */
+template <typename T>
+class TResolveHandle
+{
+public:
+    using FResolveFunctionPtr = UObject* (*)(const UnrealDI_Impl::FResolveHandleData& Data);
+
+    TResolveHandle() = default;
+
+    TResolveHandle(const TSharedRef<const UnrealDI_Impl::FResolveHandleData>& Data, FResolveFunctionPtr ResolveFunction)
+        : Data(Data)
+        , ResolveFunction(ResolveFunction)
+    {}
+
+    /* Returns true if this handle was obtained from a container */
+    bool IsValid() const
+    {
+        return Data.IsValid();
+    }
+
+    /* Returns object of type T. Returns T* for UObjects and TScriptInterface<T> for interfaces */
+    auto Resolve() const
+    {
+        checkf(IsValid(), TEXT("Resolve called on empty TResolveHandle"));
+
+        UObject* Result = ResolveFunction(*Data);
+
+        if constexpr (TIsDerivedFrom<T, UObject>::Value)
+        {
+            return (T*)Result;
+        }
+        else
+        {
+            return TScriptInterface<T>(Result);
+        }
+    }
+
+private:
+    TSharedPtr<const UnrealDI_Impl::FResolveHandleData> Data;
+    FResolveFunctionPtr ResolveFunction = nullptr;
+};
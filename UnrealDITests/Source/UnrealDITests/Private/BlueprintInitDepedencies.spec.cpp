@@ -47,6 +47,20 @@ void FBlueprintInitDependenciesSpec::Define()
         TestNotNull("Injected Object", Object->DependencyObject.Get());
     });
 
+    It("Should call InitDependencies on every Object created from same registration", [this]
+    {
+        UObjectContainer* Container = CreateContainer("/UnrealDITests/BP_TestInitDependencies_I_N_O.BP_TestInitDependencies_I_N_O_C");
+
+        UTestBlueprintInitDependencies* First = Container->Resolve<UTestBlueprintInitDependencies>();
+        UTestBlueprintInitDependencies* Second = Container->Resolve<UTestBlueprintInitDependencies>();
+
+        TestNotEqual("Objects", First, Second);
+        TestNotNull("First Injected Interface", First->DependencyInterface.GetInterface());
+        TestNotNull("First Injected Object", First->DependencyObject.Get());
+        TestNotNull("Second Injected Interface", Second->DependencyInterface.GetInterface());
+        TestNotNull("Second Injected Object", Second->DependencyObject.Get());
+    });
+
     It("Should call InitDependencies on class without Native base", [this]
     {
         FSoftObjectPath Path(TEXT("/UnrealDITests/BP_TestInitDependencies_Pure.BP_TestInitDependencies_Pure_C"));
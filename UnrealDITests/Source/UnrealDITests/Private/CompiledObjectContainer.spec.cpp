@@ -0,0 +1,110 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#include "DI/ObjectContainer.h"
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/CompiledObjectContainer.h"
+
+#include "MockReader.h"
+#include "MockClasses.h"
+
+BEGIN_DEFINE_SPEC(FCompiledObjectContainerSpec, "UnrealDI.CompiledObjectContainer", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FCompiledObjectContainerSpec)
+
+void FCompiledObjectContainerSpec::Define()
+{
+    It("Should Build containers with registered types", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        Builder.RegisterType<UNeedInterfaceInstance>();
+
+        TSharedRef<const FCompiledObjectContainer> Compiled = Builder.Compile();
+        UObjectContainer* First = Compiled->Build();
+        UObjectContainer* Second = Compiled->Build();
+
+        TestNotEqual("Containers", First, Second);
+        TestNotNull("Resolved from first", First->Resolve<UNeedInterfaceInstance>()->Instance.GetObject());
+        TestNotNull("Resolved from second", Second->Resolve<UNeedInterfaceInstance>()->Instance.GetObject());
+    });
+
+    It("Should create SingleInstance objects per container", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockBetterReader>().As<IReader>().As<IBetterReader>().SingleInstance();
+
+        TSharedRef<const FCompiledObjectContainer> Compiled = Builder.Compile();
+        UObjectContainer* First = Compiled->Build();
+        UObjectContainer* Second = Compiled->Build();
+
+        TestNotEqual("Resolved objects", First->Resolve<IReader>().GetObject(), Second->Resolve<IReader>().GetObject());
+        TestEqual("Resolved by other interface", First->Resolve<IBetterReader>().GetObject(), First->Resolve<IReader>().GetObject());
+    });
+
+    It("Should share registered instances", [this]
+    {
+        UMockReader* Instance = NewObject<UMockReader>();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterInstance<UMockReader>(Instance).As<IReader>();
+
+        TSharedRef<const FCompiledObjectContainer> Compiled = Builder.Compile();
+
+        TestEqual("First container", Compiled->Build()->Resolve<IReader>().GetObject(), (UObject*)Instance);
+        TestEqual("Second container", Compiled->Build()->Resolve<IReader>().GetObject(), (UObject*)Instance);
+    });
+
+    It("Should Resolve container itself as IResolver", [this]
+    {
+        TSharedRef<const FCompiledObjectContainer> Compiled = FObjectContainerBuilder().Compile();
+        UObjectContainer* Container = Compiled->Build();
+
+        TestEqual("Resolved IResolver", Container->Resolve<IResolver>().GetObject(), (UObject*)Container);
+        TestEqual("Resolved IInjectorProvider", Container->Resolve<IInjectorProvider>().GetObject(), (UObject*)Container);
+    });
+
+    It("Should Build Nested container", [this]
+    {
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* ParentContainer = ParentBuilder.Build();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UNeedInterfaceInstance>();
+
+        UObjectContainer* Container = Builder.Compile()->BuildNested(*ParentContainer);
+
+        TestEqual("Resolved object", Container->Resolve<UNeedInterfaceInstance>()->Instance.GetObject(), ParentContainer->Resolve<IReader>().GetObject());
+    });
+
+    It("Should not depend on Builder after Compile", [this]
+    {
+        TSharedPtr<const FCompiledObjectContainer> Compiled;
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance(true);
+            Compiled = Builder.Compile();
+        }
+
+        UObjectContainer* Container = Compiled->Build();
+
+        TObjectContainerIterator<IReader> It = Container->CreateIterator<IReader>();
+        TestNotNull("AutoCreated object", It.Get(false).GetObject());
+    });
+
+    It("Should not depend on compiled registrations after Build", [this]
+    {
+        UObjectContainer* Container = nullptr;
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+            Container = Builder.Compile()->Build();
+        }
+
+        UObject* First = Container->Resolve<IReader>().GetObject();
+
+        TestNotNull("Resolved object", First);
+        TestEqual("Resolved same object", Container->Resolve<IReader>().GetObject(), First);
+    });
+}
@@ -9,6 +9,7 @@
 #include "MockClasses.h"
 #include "MockReader.h"
 #include "BuildContainerHelper.h"
+#include "LatentCommands.h"
 
 BEGIN_DEFINE_SPEC(DependenciesInjectionSpec, "UnrealDI.Dependencies Injection", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
 END_DEFINE_SPEC(DependenciesInjectionSpec)
@@ -225,4 +226,88 @@ void DependenciesInjectionSpec::Define()
 
         TestNotNull("Reader", Reader.GetInterface());
     });
+
+    Describe("Reused arguments", [this]
+    {
+        It("Should Inject same SingleInstance into every instance", [this]
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+            Builder.RegisterType<UNeedInterfaceInstance>();
+
+            UObjectContainer* Container = Builder.Build();
+
+            UNeedInterfaceInstance* First = Container->Resolve<UNeedInterfaceInstance>();
+            UNeedInterfaceInstance* Second = Container->Resolve<UNeedInterfaceInstance>();
+
+            TestNotEqual("Resolved objects", First, Second);
+            TestEqual("First Injected dependency", First->Instance.GetObject(), Container->Resolve<IReader>().GetObject());
+            TestEqual("Second Injected dependency", Second->Instance.GetObject(), Container->Resolve<IReader>().GetObject());
+        });
+
+        It("Should Inject new Transient dependency into every instance", [this]
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().As<IReader>();
+            Builder.RegisterType<UNeedInterfaceInstance>();
+
+            UObjectContainer* Container = Builder.Build();
+
+            UNeedInterfaceInstance* First = Container->Resolve<UNeedInterfaceInstance>();
+            UNeedInterfaceInstance* Second = Container->Resolve<UNeedInterfaceInstance>();
+
+            TestNotNull("First Injected dependency", First->Instance.GetObject());
+            TestNotNull("Second Injected dependency", Second->Instance.GetObject());
+            TestNotEqual("Injected dependencies", First->Instance.GetObject(), Second->Instance.GetObject());
+        });
+
+        It("Should Inject new SingleInstance after previous one was destroyed", [this]
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+            Builder.RegisterType<UNeedInterfaceInstance>();
+
+            UObjectContainer* Container = Builder.Build();
+            Container->AddToRoot();
+
+            // second call reuses arguments stored by the first one
+            Container->Resolve<UNeedInterfaceInstance>();
+            Container->Resolve<UNeedInterfaceInstance>();
+
+            TWeakObjectPtr<UObject> DestroyedReader = Container->Resolve<IReader>().GetObject();
+            DestroyedReader->MarkAsGarbage();
+
+            ADD_LATENT_AUTOMATION_COMMAND(FRunGC);
+            ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Container, DestroyedReader]()
+            {
+                UNeedInterfaceInstance* Object = Container->Resolve<UNeedInterfaceInstance>();
+
+                TestFalse("Destroyed dependency is alive", DestroyedReader.IsValid());
+                TestTrue("Injected dependency is valid", IsValid(Object->Instance.GetObject()));
+                TestEqual("Injected dependency", Object->Instance.GetObject(), Container->Resolve<IReader>().GetObject());
+
+                Container->RemoveFromRoot();
+                return true;
+            }));
+        });
+
+        It("Should Inject same Instance into every object created by Factory", [this]
+        {
+            UMockReader* Reader = NewObject<UMockReader>();
+
+            FObjectContainerBuilder Builder;
+            Builder.RegisterInstance(Reader);
+            Builder.RegisterType<UNeedObjectInstance>();
+
+            UObjectContainer* Container = Builder.Build();
+
+            TArray<UNeedObjectInstance*> Objects;
+            Container->ResolveFactory<UNeedObjectInstance>().CreateMany(3, Objects);
+
+            for (UNeedObjectInstance* Object : Objects)
+            {
+                TestEqual("Injected dependency", Object->Instance, Reader);
+            }
+        });
+    });
 }
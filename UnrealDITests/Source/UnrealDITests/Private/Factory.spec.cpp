@@ -7,6 +7,7 @@
 #include "DI/ObjectContainerBuilder.h"
 #include "BuildContainerHelper.h"
 #include "MockReader.h"
+#include "MockClasses.h"
 
 BEGIN_DEFINE_SPEC(FFactorySpec, "UnrealDI.Factory", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
 END_DEFINE_SPEC(FFactorySpec)
@@ -68,4 +69,120 @@ void FFactorySpec::Define()
         TestTrue("Factory is Valid", Factory);
         TestTrue("Factory is Valid", Factory.IsValid());
     });
+
+    It("Should resolve after container registrations were modified", [this]
+    {
+        UObjectContainer* Container = FBuildContainerHelper::Build();
+        TFactory<UMockReader> Factory = Container->ResolveFactory<UMockReader>();
+
+        UMockReader* First = Factory();
+
+        // auto registers new types and invalidates bound registration
+        Container->Resolve<UMockBetterReader>();
+        Container->Resolve<UTestOuter>();
+
+        UMockReader* Second = Factory();
+
+        TestNotNull("First resolved object", First);
+        TestNotNull("Second resolved object", Second);
+        TestNotEqual("Resolved objects", First, Second);
+    });
+
+    It("Should resolve type it was created for", [this]
+    {
+        UObjectContainer* Container = FBuildContainerHelper::Build();
+        TFactory<UObject> Factory = Container->ResolveFactory(UMockReader::StaticClass());
+
+        UObject* Resolved = Factory();
+
+        TestNotNull("Resolved object", Resolved);
+        TestTrue("Resolved object class", Resolved->IsA<UMockReader>());
+    });
+
+    Describe("CreateMany", [this]
+    {
+        It("Should create distinct transient objects", [this]
+        {
+            UObjectContainer* Container = FBuildContainerHelper::Build();
+            TFactory<UMockReader> Factory = Container->ResolveFactory<UMockReader>();
+
+            TArray<UMockReader*> Resolved;
+            Factory.CreateMany(3, Resolved);
+
+            TestEqual("Resolved.Num()", Resolved.Num(), 3);
+            TestNotNull("Resolved[0]", Resolved[0]);
+            TestNotEqual("Resolved objects", Resolved[0], Resolved[1]);
+            TestNotEqual("Resolved objects", Resolved[1], Resolved[2]);
+        });
+
+        It("Should respect single instance lifetime", [this]
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+
+            UObjectContainer* Container = Builder.Build();
+            TFactory<IReader> Factory = Container->ResolveFactory<IReader>();
+
+            TArray<TScriptInterface<IReader>> Resolved;
+            Factory.CreateMany(2, Resolved);
+
+            TestEqual("Resolved.Num()", Resolved.Num(), 2);
+            TestNotNull("Resolved[0]", Resolved[0].GetInterface());
+            TestEqual("Resolved objects", Resolved[0].GetObject(), Resolved[1].GetObject());
+        });
+
+        It("Should append to existing array", [this]
+        {
+            UObjectContainer* Container = FBuildContainerHelper::Build();
+            TFactory<UMockReader> Factory = Container->ResolveFactory<UMockReader>();
+
+            TArray<UMockReader*> Resolved = { Factory() };
+            Factory.CreateMany(2, Resolved);
+            Factory.CreateMany(0, Resolved);
+
+            TestEqual("Resolved.Num()", Resolved.Num(), 3);
+        });
+    });
+
+    Describe("Runtime arguments", [this]
+    {
+        It("Should pass arguments after dependencies are injected", [this]
+        {
+            UObjectContainer* Container = FBuildContainerHelper::Build();
+            TFactory<UNeedRuntimeArguments, int32, const FString&> Factory = Container->ResolveFactory<UNeedRuntimeArguments, int32, const FString&>();
+
+            UNeedRuntimeArguments* Resolved = Factory(42, TEXT("Name"));
+
+            TestNotNull("Resolved object", Resolved);
+            TestNotNull("Injected dependency", Resolved->Instance);
+            TestTrue("Injected before arguments", Resolved->bWasInjectedBeforeArguments);
+            TestEqual("Value", Resolved->Value, 42);
+            TestEqual("Name", Resolved->Name, FString(TEXT("Name")));
+        });
+
+        It("Should pass arguments to every object created by CreateMany", [this]
+        {
+            UObjectContainer* Container = FBuildContainerHelper::Build();
+            TFactory<UNeedRuntimeArguments, int32, const FString&> Factory = Container->ResolveFactory<UNeedRuntimeArguments, int32, const FString&>();
+
+            TArray<UNeedRuntimeArguments*> Resolved;
+            Factory.CreateMany(2, Resolved, 7, TEXT("Many"));
+
+            TestEqual("Resolved.Num()", Resolved.Num(), 2);
+            for (UNeedRuntimeArguments* Object : Resolved)
+            {
+                TestTrue("Injected before arguments", Object->bWasInjectedBeforeArguments);
+                TestEqual("Value", Object->Value, 7);
+            }
+        });
+
+        It("Should be injected as dependency", [this]
+        {
+            UObjectContainer* Container = FBuildContainerHelper::Build();
+            UNeedRuntimeArgumentsFactory* Resolved = Container->Resolve<UNeedRuntimeArgumentsFactory>();
+
+            TestTrue("Factory is Valid", Resolved->Factory.IsValid());
+            TestEqual("Value", Resolved->Factory(3, TEXT("Dependency"))->Value, 3);
+        });
+    });
 }
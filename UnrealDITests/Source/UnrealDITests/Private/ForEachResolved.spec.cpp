@@ -0,0 +1,106 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#include "DI/ObjectContainer.h"
+#include "DI/ObjectContainerBuilder.h"
+
+#include "MockReader.h"
+
+BEGIN_DEFINE_SPEC(FForEachResolvedSpec, "UnrealDI.ForEachResolved", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FForEachResolvedSpec)
+
+void FForEachResolvedSpec::Define()
+{
+    It("Should visit all registrations of UObject type", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>();
+        Builder.RegisterType<UMockReader>();
+
+        UObjectContainer* Container = Builder.Build();
+
+        int32 Counter = 0;
+        Container->ForEachResolved<UMockReader>([&](UMockReader* Reader)
+        {
+            TestNotNull("Visited object", Reader);
+            ++Counter;
+        });
+
+        TestEqual("Counter", Counter, 2);
+    });
+
+    It("Should visit all registrations of Interface type", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+        Builder.RegisterType<UMockBetterReader>().As<IReader>();
+
+        UObjectContainer* Container = Builder.Build();
+
+        int32 Counter = 0;
+        Container->ForEachResolved<IReader>([&](TScriptInterface<IReader> Reader)
+        {
+            TestNotNull("Visited interface", Reader.GetInterface());
+            ++Counter;
+        });
+
+        TestEqual("Counter", Counter, 2);
+    });
+
+    It("Should visit registrations in parent container first", [this]
+    {
+        UMockReader* ParentReader = NewObject<UMockReader>();
+        UMockReader* ChildReader = NewObject<UMockReader>();
+
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.RegisterInstance(ParentReader);
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterInstance(ChildReader);
+
+        UObjectContainer* Container = Builder.BuildNested(*ParentBuilder.Build());
+
+        TArray<UMockReader*> Visited;
+        Container->ForEachResolved<UMockReader>([&](UMockReader* Reader)
+        {
+            Visited.Add(Reader);
+        });
+
+        TestEqual("Visited.Num()", Visited.Num(), 2);
+        TestEqual("Visited[0]", Visited[0], ParentReader);
+        TestEqual("Visited[1]", Visited[1], ChildReader);
+    });
+
+    It("Should visit same objects as ResolveAll", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UMockBetterReader>().As<IReader>().SingleInstance();
+
+        UObjectContainer* Container = Builder.Build();
+        TArray<TScriptInterface<IReader>> Expected = Container->ResolveAll<IReader>().ToArray();
+
+        int32 Index = 0;
+        Container->ForEachResolved<IReader>([&](TScriptInterface<IReader> Reader)
+        {
+            TestEqual(FString::Printf(TEXT("Visited[%d]"), Index), Reader.GetObject(), Expected[Index].GetObject());
+            ++Index;
+        });
+
+        TestEqual("Counter", Index, Expected.Num());
+    });
+
+    It("Should not visit anything if type is not registered", [this]
+    {
+        UObjectContainer* Container = FObjectContainerBuilder().Build();
+
+        int32 Counter = 0;
+        Container->ForEachResolved<IReader>([&](TScriptInterface<IReader> Reader)
+        {
+            ++Counter;
+        });
+
+        TestEqual("Counter", Counter, 0);
+    });
+}
@@ -6,6 +6,7 @@
 #include "DI/ObjectContainer.h"
 
 #include "MockClasses_Injector.h"
+#include "MockReader.h"
 #include "BuildContainerHelper.h"
 
 BEGIN_DEFINE_SPEC(IInjectorSpec, "UnrealDI.IInjector", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
@@ -76,4 +77,51 @@ void IInjectorSpec::Define()
         TestTrue("Was injected", bResult);
         TestNotNull("Injected instance", TargetObject->Instance.GetObject());
     });
+
+    It("Should not be able to Inject into type without InitDependencies", [this]
+    {
+        auto Injector = CreateInjector();
+
+        // second call is answered from injectable classes cache
+        TestFalse("CanInject", Injector->CanInject(UMockReader::StaticClass()));
+        TestFalse("CanInject cached", Injector->CanInject(UMockReader::StaticClass()));
+        TestTrue("CanInject into injectable type", Injector->CanInject(UTestInjection_Base::StaticClass()));
+        TestTrue("CanInject into injectable type cached", Injector->CanInject(UTestInjection_Base::StaticClass()));
+    });
+
+    It("Should Inject into all objects", [this]
+    {
+        TArray<UObject*> TargetObjects =
+        {
+            NewObject<UTestInjection_Base>(),
+            NewObject<UTestInjection_Derived>(),
+            NewObject<UTestInjection_Base>(),
+            NewObject<UMockReader>(),
+        };
+        auto Injector = CreateInjector();
+
+        int32 NumInjected = Injector->InjectAll(TargetObjects);
+
+        TestEqual("Injected objects Num", NumInjected, 3);
+        TestNotNull("Injected instance 0", CastChecked<UTestInjection_Base>(TargetObjects[0])->Instance.GetObject());
+        TestNotNull("Injected instance 1", CastChecked<UTestInjection_Base>(TargetObjects[1])->Instance.GetObject());
+        TestNotNull("Injected instance 2", CastChecked<UTestInjection_Base>(TargetObjects[2])->Instance.GetObject());
+    });
+
+    It("Should Inject same shared object into all objects", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* Container = Builder.Build();
+
+        UTestInjection_Base* First = NewObject<UTestInjection_Base>();
+        UTestInjection_Base* Second = NewObject<UTestInjection_Base>();
+
+        TArray<UObject*> TargetObjects = { First, Second };
+        Container->InjectAll(TargetObjects);
+
+        TestNotNull("Injected instance", First->Instance.GetObject());
+        TestEqual("Injected instances", First->Instance.GetObject(), Second->Instance.GetObject());
+        TestEqual("Resolved after batch", Container->Resolve<IReader>().GetObject(), First->Instance.GetObject());
+    });
 }
\ No newline at end of file
@@ -6,10 +6,12 @@
 #include "DI/ObjectContainerBuilder.h"
 #include "DI/ObjectContainer.h"
 #include "DI/Impl/DefaultInstanceFactory.h"
+#include "Engine/EngineTypes.h"
 
 #include "TempWorldHelper.h"
 #include "MockClasses_InjectOnConstruction.h"
 #include "TestInstanceFactory.h"
+#include "MockClasses.h"
 
 BEGIN_DEFINE_SPEC(FIInstanceFactorySpec, "UnrealDI.IInstanceFactory", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
 END_DEFINE_SPEC(FIInstanceFactorySpec)
@@ -46,6 +48,91 @@ void FIInstanceFactorySpec::Define()
         TestEqual("Result class", Result->GetClass(), AInjectActor::StaticClass());
     });
 
+    It("Should create AActor with creation params", [this]
+    {
+        FTempWorldHelper Helper;
+        UDefaultInstanceFactory* Factory = GetMutableDefault<UDefaultInstanceFactory>();
+
+        AActor* Owner = Helper.World->SpawnActor<AInjectActor>();
+
+        FObjectCreationParams Params;
+        Params.Owner = Owner;
+        Params.CollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+        AActor* Result = Cast<AActor>(Factory->CreateWithParams(Helper.World, AInjectActor::StaticClass(), Params));
+        Factory->FinalizeCreationWithParams(Result, Params);
+
+        TestNotNull("Result", Result);
+        TestEqual("Result owner", Result->GetOwner(), Owner);
+        TestTrue("Result collision handling", Result->SpawnCollisionHandlingMethod == ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+    });
+
+    It("Should pass creation params from Resolve", [this]
+    {
+        FTempWorldHelper Helper;
+        UObjectContainer* Container = FObjectContainerBuilder().Build(Helper.World);
+
+        AActor* Owner = Helper.World->SpawnActor<AInjectActor>();
+
+        FObjectCreationParams Params;
+        Params.Owner = Owner;
+
+        AInjectActor* Result = Container->Resolve<AInjectActor>(Params);
+
+        TestNotNull("Result", Result);
+        TestEqual("Result owner", Result->GetOwner(), Owner);
+    });
+
+    It("Should create UObject in Outer from creation params", [this]
+    {
+        UObjectContainer* Container = FObjectContainerBuilder().Build();
+        UTestOuter* Outer = NewObject<UTestOuter>();
+
+        FObjectCreationParams Params;
+        Params.Outer = Outer;
+
+        UInjectObject* Result = Container->Resolve<UInjectObject>(Params);
+
+        TestNotNull("Result", Result);
+        TestEqual("Result outer", Result->GetOuter(), (UObject*)Outer);
+    });
+
+    It("Should spawn AActor into Level from creation params", [this]
+    {
+        FTempWorldHelper Helper;
+        UObjectContainer* Container = FObjectContainerBuilder().Build(Helper.World);
+
+        FObjectCreationParams Params;
+        Params.Outer = Helper.World->PersistentLevel;
+
+        AInjectActor* Result = Container->Resolve<AInjectActor>(Params);
+
+        TestNotNull("Result", Result);
+        TestEqual("Result level", Result->GetLevel(), Helper.World->PersistentLevel.Get());
+    });
+
+    It("Should create and finalize many AActors", [this]
+    {
+        FTempWorldHelper Helper;
+        UDefaultInstanceFactory* Factory = GetMutableDefault<UDefaultInstanceFactory>();
+
+        TArray<UObject*> Result;
+        Result.AddZeroed(3);
+
+        Factory->CreateMany(Helper.World, AInjectActor::StaticClass(), FObjectCreationParams(), Result);
+        for (UObject* Object : Result)
+        {
+            TestNotNull("Created object", Object);
+            TestFalse("Finished spawning before finalize", CastChecked<AActor>(Object)->IsActorInitialized());
+        }
+
+        Factory->FinalizeCreationMany(Result, FObjectCreationParams());
+        for (UObject* Object : Result)
+        {
+            TestTrue("Finished spawning after finalize", CastChecked<AActor>(Object)->IsActorInitialized());
+        }
+    });
+
     It("Should create UUserWidget", [this]
     {
         FTempWorldHelper Helper;
@@ -144,4 +231,31 @@ void FIInstanceFactorySpec::Define()
         TestEqual("Result Name ComparisonIndex", SecondName.GetComparisonIndex(), ClassName.GetComparisonIndex());
         TestNotEqual("Result Name Number", SecondName.GetNumber(), ClassName.GetNumber());
     });
+
+    It("Should not give fixed name if naming policy is Unique", [this]
+    {
+        FTempWorldHelper Helper;
+        UDefaultInstanceFactory* Factory = GetMutableDefault<UDefaultInstanceFactory>();
+
+        FObjectCreationParams Params;
+        Params.NamingPolicy = EObjectNamingPolicy::Unique;
+
+        UObject* Result = Factory->CreateWithParams(Helper.World, UInjectObject::StaticClass(), Params);
+        Factory->FinalizeCreationWithParams(Result, Params);
+
+        TestNotEqual("Result Name", Result->GetFName(), UInjectObject::StaticClass()->GetFName());
+    });
+
+    It("Should use naming policy of registration", [this]
+    {
+        FTempWorldHelper Helper;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UInjectObject>().WithNamingPolicy(EObjectNamingPolicy::Unique);
+
+        UObjectContainer* Container = Builder.Build(Helper.World);
+        UInjectObject* Result = Container->Resolve<UInjectObject>();
+
+        TestNotEqual("Result Name", Result->GetFName(), UInjectObject::StaticClass()->GetFName());
+    });
 }
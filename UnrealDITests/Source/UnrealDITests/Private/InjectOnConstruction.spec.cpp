@@ -5,6 +5,8 @@
 
 #include "DI/ObjectContainerBuilder.h"
 #include "DI/ObjectContainer.h"
+#include "DI/Impl/DeferredInjectionQueue.h"
+#include "Async/Async.h"
 
 #include "MockClasses.h"
 #include "BuildContainerHelper.h"
@@ -145,6 +147,28 @@ void InjectOnConstructionSpec::Define()
         FInjectOnConstruction::ClearContainerForWorld(Helper.World);
     });
 
+    It("Should use custom IInjector for class without InitDependencies", [this]
+    {
+        FTempWorldHelper Helper;
+
+        UTestCountingInjector* Injector = NewObject<UTestCountingInjector>();
+        UTestInjectorProvider* InjectorProvider = NewObject<UTestInjectorProvider>();
+        InjectorProvider->Injector = Injector;
+
+        UObjectContainer* WorldContainer = FBuildContainerHelper::Build(Helper.World, [&](FObjectContainerBuilder& Builder)
+        {
+            Builder.RegisterInstance(InjectorProvider).As<IInjectorProvider>();
+        });
+
+        FInjectOnConstruction::SetContainerForWorld(Helper.World, WorldContainer);
+
+        NewObject<UInjectObjectWithoutInitDependencies>(Helper.World); // will call TryInitDependencies from constructor
+
+        TestEqual("Injected objects", Injector->NumInjected, 1);
+
+        FInjectOnConstruction::ClearContainerForWorld(Helper.World);
+    });
+
     It("Should use custom IInjectorProvider in Nested container from Parent container", [this]
     {
         FTempWorldHelper Helper;
@@ -184,4 +208,136 @@ void InjectOnConstructionSpec::Define()
 
         FInjectOnConstruction::ClearContainerForWorld(Helper.World);
     });
+
+    Describe("Cache", [this]
+    {
+        It("Should call GetInjector once per class if Injector is stable", [this]
+        {
+            FTempWorldHelper Helper;
+
+            UObjectContainer* OtherContainer = FBuildContainerHelper::Build();
+            UTestInjectorProvider* InjectorProvider = NewObject<UTestInjectorProvider>();
+            InjectorProvider->Injector = OtherContainer;
+            InjectorProvider->bStablePerClass = true;
+
+            UObjectContainer* WorldContainer = FBuildContainerHelper::Build(Helper.World, [&](FObjectContainerBuilder& Builder)
+            {
+                Builder.RegisterInstance(InjectorProvider).As<IInjectorProvider>();
+            });
+
+            FInjectOnConstruction::SetContainerForWorld(Helper.World, WorldContainer);
+
+            UInjectObject* FirstObject = NewObject<UInjectObject>(Helper.World);
+            UInjectObject* SecondObject = NewObject<UInjectObject>(Helper.World);
+
+            TestEqual("First Resolver", FirstObject->Resolver, TScriptInterface<IResolver>(OtherContainer));
+            TestEqual("Second Resolver", SecondObject->Resolver, TScriptInterface<IResolver>(OtherContainer));
+            TestEqual("GetInjector calls", InjectorProvider->NumGetInjectorCalls, 1);
+
+            FInjectOnConstruction::ClearContainerForWorld(Helper.World);
+        });
+
+        It("Should call GetInjector for each object if Injector is not stable", [this]
+        {
+            FTempWorldHelper Helper;
+
+            UTestInjectorProvider* InjectorProvider = NewObject<UTestInjectorProvider>();
+            InjectorProvider->Injector = FBuildContainerHelper::Build();
+
+            UObjectContainer* WorldContainer = FBuildContainerHelper::Build(Helper.World, [&](FObjectContainerBuilder& Builder)
+            {
+                Builder.RegisterInstance(InjectorProvider).As<IInjectorProvider>();
+            });
+
+            FInjectOnConstruction::SetContainerForWorld(Helper.World, WorldContainer);
+
+            NewObject<UInjectObject>(Helper.World);
+            NewObject<UInjectObject>(Helper.World);
+
+            TestEqual("GetInjector calls", InjectorProvider->NumGetInjectorCalls, 2);
+
+            FInjectOnConstruction::ClearContainerForWorld(Helper.World);
+        });
+
+        It("Should use new Container after it is ReSet for World", [this]
+        {
+            FTempWorldHelper Helper;
+
+            UObjectContainer* Container = FObjectContainerBuilder().Build(Helper.World);
+            UObjectContainer* Container2 = FObjectContainerBuilder().Build(Helper.World);
+
+            FInjectOnConstruction::SetContainerForWorld(Helper.World, Container);
+            UInjectObject* FirstObject = NewObject<UInjectObject>(Helper.World);
+
+            FInjectOnConstruction::SetContainerForWorld(Helper.World, Container2);
+            UInjectObject* SecondObject = NewObject<UInjectObject>(Helper.World);
+
+            TestEqual("First Resolver", FirstObject->Resolver, TScriptInterface<IResolver>(Container));
+            TestEqual("Second Resolver", SecondObject->Resolver, TScriptInterface<IResolver>(Container2));
+
+            FInjectOnConstruction::ClearContainerForWorld(Helper.World);
+        });
+
+        It("Should not Inject after Container is Cleared for World", [this]
+        {
+            FTempWorldHelper Helper;
+
+            UObjectContainer* Container = FObjectContainerBuilder().Build(Helper.World);
+
+            FInjectOnConstruction::SetContainerForWorld(Helper.World, Container);
+            NewObject<UInjectObject>(Helper.World);
+            FInjectOnConstruction::ClearContainerForWorld(Helper.World);
+
+            UInjectObject* Object = NewObject<UInjectObject>(Helper.World);
+
+            TestNull("Resolver", Object->Resolver.GetObject());
+        });
+    });
+
+    Describe("Deferred injection", [this]
+    {
+        It("Should Inject objects queued from other thread on Flush", [this]
+        {
+            FTempWorldHelper Helper;
+
+            // no container yet, so constructor does not inject anything
+            UInjectObject* Object = NewObject<UInjectObject>(Helper.World);
+
+            UObjectContainer* Container = FObjectContainerBuilder().Build(Helper.World);
+            FInjectOnConstruction::SetContainerForWorld(Helper.World, Container);
+
+            Async(EAsyncExecution::ThreadPool, [Object] { UnrealDI_Impl::FDeferredInjectionQueue::Enqueue(Object); }).Wait();
+
+            TestNull("Resolver before Flush", Object->Resolver.GetObject());
+
+            UnrealDI_Impl::FDeferredInjectionQueue::Flush();
+
+            TestEqual("Resolver after Flush", Object->Resolver, TScriptInterface<IResolver>(Container));
+
+            FInjectOnConstruction::ClearContainerForWorld(Helper.World);
+        });
+
+        It("Should not Inject objects that are still loading", [this]
+        {
+            FTempWorldHelper Helper;
+
+            UInjectObject* Object = NewObject<UInjectObject>(Helper.World);
+
+            UObjectContainer* Container = FObjectContainerBuilder().Build(Helper.World);
+            FInjectOnConstruction::SetContainerForWorld(Helper.World, Container);
+
+            Object->SetFlags(RF_NeedPostLoad);
+            UnrealDI_Impl::FDeferredInjectionQueue::Enqueue(Object);
+            UnrealDI_Impl::FDeferredInjectionQueue::Flush();
+
+            TestNull("Resolver while loading", Object->Resolver.GetObject());
+
+            Object->ClearFlags(RF_NeedPostLoad);
+            UnrealDI_Impl::FDeferredInjectionQueue::Flush();
+
+            TestEqual("Resolver after loading", Object->Resolver, TScriptInterface<IResolver>(Container));
+
+            FInjectOnConstruction::ClearContainerForWorld(Helper.World);
+        });
+    });
 }
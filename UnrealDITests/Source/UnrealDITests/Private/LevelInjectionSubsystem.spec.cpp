@@ -0,0 +1,121 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ObjectContainer.h"
+#include "DI/LevelInjectionSubsystem.h"
+#include "Engine/Level.h"
+#include "UObject/UnrealType.h"
+
+#include "MockClasses_InjectOnConstruction.h"
+#include "TempWorldHelper.h"
+
+// subsystem is disabled by default, enables it for worlds created while scope exists
+struct FEnableLevelInjectionScope
+{
+    FEnableLevelInjectionScope()
+        : EnabledProperty(FindFProperty<FBoolProperty>(ULevelInjectionSubsystem::StaticClass(), TEXT("bEnabled")))
+        , Defaults(GetMutableDefault<ULevelInjectionSubsystem>())
+        , bWasEnabled(EnabledProperty->GetPropertyValue_InContainer(Defaults))
+    {
+        EnabledProperty->SetPropertyValue_InContainer(Defaults, true);
+    }
+
+    ~FEnableLevelInjectionScope()
+    {
+        EnabledProperty->SetPropertyValue_InContainer(Defaults, bWasEnabled);
+    }
+
+    FBoolProperty* EnabledProperty;
+    ULevelInjectionSubsystem* Defaults;
+    bool bWasEnabled;
+};
+
+BEGIN_DEFINE_SPEC(FLevelInjectionSubsystemSpec, "UnrealDI.LevelInjectionSubsystem", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FLevelInjectionSubsystemSpec)
+
+void FLevelInjectionSubsystemSpec::Define()
+{
+    It("Should Inject all Actors and Components in Level", [this]
+    {
+        FTempWorldHelper Helper;
+        UObjectContainer* Container = FObjectContainerBuilder().Build(Helper.World);
+
+        ALevelInjectActor* FirstActor = Helper.World->SpawnActor<ALevelInjectActor>();
+        ALevelInjectActor* SecondActor = Helper.World->SpawnActor<ALevelInjectActor>();
+
+        FInjectOnConstruction::SetContainerForWorld(Helper.World, Container);
+
+        int32 NumInjected = ULevelInjectionSubsystem::InjectLevel(Helper.World->PersistentLevel);
+
+        TestEqual("Injected objects Num", NumInjected, 4);
+        TestEqual("First Actor Resolver", FirstActor->Resolver, TScriptInterface<IResolver>(Container));
+        TestEqual("First Component Resolver", FirstActor->Component->Resolver, TScriptInterface<IResolver>(Container));
+        TestEqual("Second Actor Resolver", SecondActor->Resolver, TScriptInterface<IResolver>(Container));
+        TestEqual("Second Component Resolver", SecondActor->Component->Resolver, TScriptInterface<IResolver>(Container));
+
+        FInjectOnConstruction::ClearContainerForWorld(Helper.World);
+    });
+
+    It("Should not Inject anything if World has no Container", [this]
+    {
+        FTempWorldHelper Helper;
+
+        ALevelInjectActor* Actor = Helper.World->SpawnActor<ALevelInjectActor>();
+
+        int32 NumInjected = ULevelInjectionSubsystem::InjectLevel(Helper.World->PersistentLevel);
+
+        TestEqual("Injected objects Num", NumInjected, 0);
+        TestNull("Actor Resolver", Actor->Resolver.GetObject());
+    });
+
+    It("Should Inject streamed Level before BeginPlay", [this]
+    {
+        FEnableLevelInjectionScope EnableScope;
+        FTempWorldHelper Helper;
+        UObjectContainer* Container = FObjectContainerBuilder().Build(Helper.World);
+        FInjectOnConstruction::SetContainerForWorld(Helper.World, Container);
+
+        Helper.World->SetBegunPlay(true);
+
+        // emulate loaded level: actors are constructed, but not initialized until level is added to World
+        ULevel* Level = NewObject<ULevel>(Helper.World, TEXT("StreamedLevel"));
+        Level->OwningWorld = Helper.World;
+        Level->Initialize(FURL());
+
+        ALevelInjectActor* Actor = NewObject<ALevelInjectActor>(Level);
+        Level->Actors.Add(Actor);
+
+        Helper.World->AddToWorld(Level, FTransform::Identity, false);
+
+        TestTrue("Actor began play", Actor->HasActorBegunPlay());
+        TestTrue("Actor injected before BeginPlay", Actor->bInjectedBeforeBeginPlay);
+        TestEqual("Component Resolver", Actor->Component->Resolver, TScriptInterface<IResolver>(Container));
+
+        Helper.World->RemoveFromWorld(Level);
+        FInjectOnConstruction::ClearContainerForWorld(Helper.World);
+    });
+
+    It("Should not Inject Actor created by Container before BeginPlay again", [this]
+    {
+        FEnableLevelInjectionScope EnableScope;
+        FTempWorldHelper Helper;
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<ALevelInjectActor>().SingleInstance();
+        UObjectContainer* Container = Builder.Build(Helper.World);
+        FInjectOnConstruction::SetContainerForWorld(Helper.World, Container);
+
+        ALevelInjectActor* Actor = Container->Resolve<ALevelInjectActor>();
+
+        ULevelInjectionSubsystem* Subsystem = Helper.World->GetSubsystem<ULevelInjectionSubsystem>();
+        TestNotNull("Subsystem", Subsystem);
+        Subsystem->OnWorldBeginPlay(*Helper.World);
+
+        TestEqual("Actor InitDependencies calls", Actor->NumInitDependenciesCalls, 1);
+        TestEqual("Component Resolver", Actor->Component->Resolver, TScriptInterface<IResolver>(Container));
+
+        FInjectOnConstruction::ClearContainerForWorld(Helper.World);
+    });
+}
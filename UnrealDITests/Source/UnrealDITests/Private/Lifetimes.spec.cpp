@@ -9,6 +9,10 @@
 #include "MockClasses.h"
 #include "MockReader.h"
 #include "LatentCommands.h"
+#include "MockClasses_InjectOnConstruction.h"
+#include "TempWorldHelper.h"
+#include "DI/Factory.h"
+#include "DI/ObjectContainerDelegates.h"
 
 BEGIN_DEFINE_SPEC(LifetimesSpec, "UnrealDI.Lifetimes", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
 END_DEFINE_SPEC(LifetimesSpec)
@@ -84,6 +88,18 @@ void LifetimesSpec::Define()
             TestEqual("Resolve returned different objects", Reader1, Reader2);
         });
 
+        It("Should Resolve Same Object For All Interfaces", [this]()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockBetterReader>().As<IReader>().As<IBetterReader>().AsSelf().SingleInstance();
+            UObjectContainer* Container = Builder.Build();
+
+            UObject* Reader = Container->Resolve<UMockBetterReader>();
+
+            TestEqual("IReader", Container->Resolve<IReader>().GetObject(), Reader);
+            TestEqual("IBetterReader", Container->Resolve<IBetterReader>().GetObject(), Reader);
+        });
+
         It("Should Survive GC", [this]()
         {
             FObjectContainerBuilder Builder;
@@ -107,6 +123,27 @@ void LifetimesSpec::Define()
             }));
         });
 
+        It("Should Survive GC In Cloned Container", [this]()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().As<IReader>().AsSelf().SingleInstance();
+            Builder.RegisterType<UNeedInterfaceInstance>();
+            UObjectContainer* Container = Builder.Build()->Clone();
+            Container->AddToRoot();
+
+            // transient registration is created together with the singleton, make sure it does not affect held objects
+            TWeakObjectPtr<UMockReader> Reader1 = CastChecked<UMockReader>(Container->Resolve<UNeedInterfaceInstance>()->Instance.GetObject());
+
+            ADD_LATENT_AUTOMATION_COMMAND(FRunGC);
+            ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Container, Reader1]()
+            {
+                TestTrue("Object was destroyed", Reader1.IsValid());
+                TestEqual("Resolve returned different objects", Container->Resolve<UMockReader>(), Reader1.Get());
+                Container->RemoveFromRoot();
+                return true;
+            }));
+        });
+
         It("Should Create Instance After Build If AutoCreate=true", [this]()
         {
             FObjectContainerBuilder Builder;
@@ -230,4 +267,91 @@ void LifetimesSpec::Define()
             }));
         });
     });
+
+    Describe("PooledWidget", [this]()
+    {
+        It("Should Resolve New Widgets", [this]()
+        {
+            FTempWorldHelper Helper;
+
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UInjectWidget>().PooledWidget();
+            UObjectContainer* Container = Builder.Build(Helper.World);
+
+            TFactory<UInjectWidget> Factory = Container->ResolveFactory<UInjectWidget>();
+            UInjectWidget* Widget1 = Factory();
+            UInjectWidget* Widget2 = Factory();
+
+            TestNotNull("Resolve returned nullptr", Widget1);
+            TestNotNull("Dependencies injected", Widget1->Resolver.GetObject());
+            TestNotEqual("Resolve returned same objects", Widget1, Widget2);
+        });
+
+        It("Should Reuse Released Widget", [this]()
+        {
+            FTempWorldHelper Helper;
+
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UInjectWidget>().PooledWidget();
+            UObjectContainer* Container = Builder.Build(Helper.World);
+
+            TFactory<UInjectWidget> Factory = Container->ResolveFactory<UInjectWidget>();
+            UInjectWidget* Widget1 = Factory();
+            Factory.Release(Widget1);
+            UInjectWidget* Widget2 = Factory();
+
+            TestEqual("Resolve returned different objects", Widget1, Widget2);
+            TestNotNull("Dependencies kept", Widget2->Resolver.GetObject());
+        });
+
+        It("Should Inject new Widget after Released one was Reused", [this]()
+        {
+            FTempWorldHelper Helper;
+
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UInjectWidget>().PooledWidget();
+            UObjectContainer* Container = Builder.Build(Helper.World);
+
+            int32 ConstructedCount = 0;
+            FDelegateHandle ConstructedHandle = FObjectContainerDelegates::OnObjectConstructedDelegate.AddLambda([&](UObject&, const UObjectContainer&) { ++ConstructedCount; });
+
+            TFactory<UInjectWidget> Factory = Container->ResolveFactory<UInjectWidget>();
+            UInjectWidget* Widget1 = Factory();
+            Factory.Release(Widget1);
+            UInjectWidget* Widget2 = Factory();
+            UInjectWidget* Widget3 = Factory();
+
+            FObjectContainerDelegates::OnObjectConstructedDelegate.Remove(ConstructedHandle);
+
+            TestEqual("Released widget reused", Widget2, Widget1);
+            TestNotEqual("New widget created", Widget3, Widget1);
+            TestNotNull("Dependencies injected into new widget", Widget3->Resolver.GetObject());
+            TestEqual("Constructed count", ConstructedCount, 2);
+        });
+
+        It("Should Broadcast OnObjectCreated for Reused Widget", [this]()
+        {
+            FTempWorldHelper Helper;
+
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UInjectWidget>().PooledWidget();
+            UObjectContainer* Container = Builder.Build(Helper.World);
+
+            int32 ConstructedCount = 0;
+            int32 CreatedCount = 0;
+            FDelegateHandle ConstructedHandle = FObjectContainerDelegates::OnObjectConstructedDelegate.AddLambda([&](UObject&, const UObjectContainer&) { ++ConstructedCount; });
+            FDelegateHandle CreatedHandle = FObjectContainerDelegates::OnObjectCreatedDelegate.AddLambda([&](UObject&, const UObjectContainer&) { ++CreatedCount; });
+
+            TFactory<UInjectWidget> Factory = Container->ResolveFactory<UInjectWidget>();
+            UInjectWidget* Widget = Factory();
+            Factory.Release(Widget);
+            Factory();
+
+            FObjectContainerDelegates::OnObjectConstructedDelegate.Remove(ConstructedHandle);
+            FObjectContainerDelegates::OnObjectCreatedDelegate.Remove(CreatedHandle);
+
+            TestEqual("Constructed count", ConstructedCount, 1);
+            TestEqual("Created count", CreatedCount, 2);
+        });
+    });
 }
\ No newline at end of file
@@ -35,6 +35,57 @@ void ObjectContainerBuilderSpec::Define()
         TestNotNull("NestedContainer", NestedContainer);
     });
 
+    It("Should Build Container from moved Builder", [this]()
+    {
+        auto MakeBuilder = []()
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().As<IReader>();
+            return Builder;
+        };
+
+        FObjectContainerBuilder Builder = MakeBuilder();
+        TestNotNull("Resolved from move constructed Builder", Builder.Build()->Resolve<IReader>().GetObject());
+
+        Builder = MakeBuilder();
+        TestNotNull("Resolved from move assigned Builder", Builder.Build()->Resolve<IReader>().GetObject());
+    });
+
+    It("Should Build Container from copied Builder", [this]()
+    {
+        TOptional<FObjectContainerBuilder> Builder;
+        Builder.Emplace();
+        Builder->RegisterType<UMockReader>().As<IReader>();
+
+        FObjectContainerBuilder Copy = *Builder;
+        Builder.Reset();
+
+        Copy.RegisterType<UNeedInterfaceInstance>();
+        UObjectContainer* Container = Copy.Build();
+
+        TestNotNull("Resolved registration of original Builder", Container->Resolve<IReader>().GetObject());
+        TestNotNull("Resolved registration of copy", Container->Resolve<UNeedInterfaceInstance>()->Instance.GetObject());
+    });
+
+    It("Should Build Container with many Registrations", [this]()
+    {
+        int32 NumCalls = 0;
+        UObjectContainer* Container = nullptr;
+        {
+            FObjectContainerBuilder Builder;
+            for (int32 Index = 0; Index < 1000; ++Index)
+            {
+                Builder.RegisterFactory<UMockReader>([&NumCalls]() { ++NumCalls; return NewObject<UMockReader>(); }).As<IReader>();
+            }
+
+            Container = Builder.Build();
+        }
+
+        TestNotNull("Resolved object", Container->Resolve<IReader>().GetObject());
+        TestEqual("Factory calls", NumCalls, 1);
+        TestEqual("Number of registrations", Container->ResolveAll<IReader>().Num(), 1000);
+    });
+
     Describe("Register Type", [this]()
     {
         It("Should Register Type", [this]()
@@ -0,0 +1,120 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#include "DI/ObjectContainer.h"
+#include "DI/ObjectContainerBuilder.h"
+
+#include "MockReader.h"
+#include "MockClasses.h"
+
+BEGIN_DEFINE_SPEC(FObjectContainerCloneSpec, "UnrealDI.ObjectContainer.Clone", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FObjectContainerCloneSpec)
+
+void FObjectContainerCloneSpec::Define()
+{
+    It("Should Resolve registered types", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+
+        UObjectContainer* Prototype = Builder.Build();
+        UObjectContainer* Clone = Prototype->Clone();
+
+        TestNotEqual("Clone", Clone, Prototype);
+        TestTrue("IsRegistered", Clone->IsRegistered<IReader>());
+        TestNotNull("Resolved object", Clone->Resolve<IReader>().GetObject());
+    });
+
+    It("Should create own SingleInstance objects", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockBetterReader>().As<IReader>().As<IBetterReader>().SingleInstance();
+
+        UObjectContainer* Prototype = Builder.Build();
+        UObject* PrototypeObject = Prototype->Resolve<IReader>().GetObject();
+
+        UObjectContainer* Clone = Prototype->Clone();
+        UObject* CloneObject = Clone->Resolve<IReader>().GetObject();
+
+        TestNotEqual("Clone object", CloneObject, PrototypeObject);
+        TestEqual("Clone object by other interface", Clone->Resolve<IBetterReader>().GetObject(), CloneObject);
+        TestEqual("Prototype object", Prototype->Resolve<IReader>().GetObject(), PrototypeObject);
+    });
+
+    It("Should inject own SingleInstance objects", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UNeedInterfaceInstance>();
+
+        UObjectContainer* Prototype = Builder.Build();
+        Prototype->Resolve<UNeedInterfaceInstance>();
+
+        UObjectContainer* Clone = Prototype->Clone();
+        UNeedInterfaceInstance* Object = Clone->Resolve<UNeedInterfaceInstance>();
+
+        TestEqual("Injected object", Object->Instance.GetObject(), Clone->Resolve<IReader>().GetObject());
+    });
+
+    It("Should inject own SingleInstance objects when resolving alternately", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        Builder.RegisterType<UNeedInterfaceInstance>();
+
+        UObjectContainer* Prototype = Builder.Build();
+        UObjectContainer* Clone = Prototype->Clone();
+
+        for (int32 Index = 0; Index < 3; ++Index)
+        {
+            TestEqual("Prototype object", Prototype->Resolve<UNeedInterfaceInstance>()->Instance.GetObject(), Prototype->Resolve<IReader>().GetObject());
+            TestEqual("Clone object", Clone->Resolve<UNeedInterfaceInstance>()->Instance.GetObject(), Clone->Resolve<IReader>().GetObject());
+        }
+    });
+
+    It("Should share registered instances", [this]
+    {
+        UMockReader* Instance = NewObject<UMockReader>();
+
+        FObjectContainerBuilder Builder;
+        Builder.RegisterInstance<UMockReader>(Instance).As<IReader>();
+
+        UObjectContainer* Clone = Builder.Build()->Clone();
+
+        TestEqual("Resolved object", Clone->Resolve<IReader>().GetObject(), (UObject*)Instance);
+    });
+
+    It("Should Resolve itself as IResolver", [this]
+    {
+        UObjectContainer* Prototype = FObjectContainerBuilder().Build();
+        UObjectContainer* Clone = Prototype->Clone();
+
+        TestEqual("Resolved IResolver", Clone->Resolve<IResolver>().GetObject(), (UObject*)Clone);
+        TestEqual("Resolved IInjector", Clone->Resolve<IInjector>().GetObject(), (UObject*)Clone);
+    });
+
+    It("Should keep Parent container", [this]
+    {
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* ParentContainer = ParentBuilder.Build();
+
+        UObjectContainer* Prototype = FObjectContainerBuilder().BuildNested(*ParentContainer);
+        UObjectContainer* Clone = Prototype->Clone();
+
+        TestEqual("Resolved object", Clone->Resolve<IReader>().GetObject(), ParentContainer->Resolve<IReader>().GetObject());
+    });
+
+    It("Should create AutoCreate objects", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance(true);
+
+        UObjectContainer* Clone = Builder.Build()->Clone();
+
+        TObjectContainerIterator<IReader> It = Clone->CreateIterator<IReader>();
+        TestTrue("Has registration", (bool)It);
+        TestNotNull("Created object", It.Get(false).GetObject());
+    });
+}
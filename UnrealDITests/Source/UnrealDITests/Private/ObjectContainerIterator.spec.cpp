@@ -5,8 +5,11 @@
 #include "DI/ObjectContainer.h"
 #include "DI/ObjectContainerBuilder.h"
 #include "DI/ObjectContainerIterator.h"
+#include "DI/ObjectContainerParallel.h"
 
-#include "MockReader.h" 
+#include "MockReader.h"
+
+#include <atomic>
 
 BEGIN_DEFINE_SPEC(FObjectContainerIteratorSpec, "UnrealDI.ObjectContainerIterator", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
 template <typename T>
@@ -193,6 +196,24 @@ void FObjectContainerIteratorSpec::Define()
         TestEqual("Counter", Count(It), (3 /*builtin*/ + 2 /*manual*/) * 2 /*containers*/);
     });
 
+    It("Should Iterate over types registered after previous iteration", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>();
+
+        UObjectContainer* Container = Builder.Build();
+        TObjectContainerIterator<UMockReader> FirstIt = Container->CreateIterator<UMockReader>();
+
+        TestEqual("Counter before auto registration", Count(FirstIt), 1);
+
+        // auto registers UMockBetterReader
+        Container->Resolve<UMockBetterReader>();
+
+        TObjectContainerIterator<UMockReader> SecondIt = Container->CreateIterator<UMockReader>();
+
+        TestEqual("Counter after auto registration", Count(SecondIt), 2);
+    });
+
     It("Should return existing instance", [this]
     {
         FObjectContainerBuilder Builder;
@@ -225,6 +246,46 @@ void FObjectContainerIteratorSpec::Define()
 
         TestNotNull("Existing instance", It.Get(true));
     });
+
+    Describe("ParallelForEachExisting", [this]
+    {
+        It("Should visit only existing instances", [this]
+        {
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance(true);
+            Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance(true);
+            Builder.RegisterType<UMockReader>().As<IReader>();
+
+            UObjectContainer* Container = Builder.Build();
+
+            std::atomic<int32> Counter = 0;
+            ParallelForEachExisting<IReader>(*Container, [&Counter](TScriptInterface<IReader> Reader)
+            {
+                Counter += Reader.GetInterface() != nullptr ? 1 : 0;
+            });
+
+            TestEqual("Counter", Counter.load(), 2);
+        });
+
+        It("Should visit instances in parent container", [this]
+        {
+            FObjectContainerBuilder ParentBuilder;
+            ParentBuilder.RegisterType<UMockReader>().SingleInstance(true);
+
+            FObjectContainerBuilder Builder;
+            Builder.RegisterType<UMockReader>().SingleInstance(true);
+
+            UObjectContainer* Container = Builder.BuildNested(*ParentBuilder.Build());
+
+            std::atomic<int32> Counter = 0;
+            ParallelForEachExisting<UMockReader>(*Container, [&Counter](UMockReader* Reader)
+            {
+                ++Counter;
+            }, EObjectContainerIteratorFlags::IncludeParent);
+
+            TestEqual("Counter", Counter.load(), 2);
+        });
+    });
 }
 
 template <typename T>
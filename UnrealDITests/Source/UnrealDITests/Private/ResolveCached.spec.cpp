@@ -0,0 +1,120 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#include "DI/ObjectContainer.h"
+#include "DI/ObjectContainerBuilder.h"
+
+#include "MockReader.h"
+#include "MockClasses.h"
+
+namespace ResolveCachedSpec
+{
+    // single call site shared by all containers passed here
+    TScriptInterface<IReader> ResolveReader(UObjectContainer* Container)
+    {
+        return UNREALDI_RESOLVE_CACHED(Container, IReader);
+    }
+}
+
+BEGIN_DEFINE_SPEC(FResolveCachedSpec, "UnrealDI.ResolveCached", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FResolveCachedSpec)
+
+void FResolveCachedSpec::Define()
+{
+    It("Should Resolve UObject", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>();
+
+        UObjectContainer* Container = Builder.Build();
+
+        UnrealDI_Impl::FResolveInlineCache Cache;
+        static_assert(std::is_same_v<UMockReader*, decltype(Container->ResolveCached<UMockReader>(Cache))>, "Incorrect return type");
+
+        TestNotNull("Resolved object", Container->ResolveCached<UMockReader>(Cache));
+        TestNotNull("Resolved object from filled cache", Container->ResolveCached<UMockReader>(Cache));
+    });
+
+    It("Should Resolve Interface", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+
+        UObjectContainer* Container = Builder.Build();
+
+        UnrealDI_Impl::FResolveInlineCache Cache;
+        static_assert(std::is_same_v<TScriptInterface<IReader>, decltype(Container->ResolveCached<IReader>(Cache))>, "Incorrect return type");
+
+        TestNotNull("Resolved interface", UNREALDI_RESOLVE_CACHED(Container, IReader).GetInterface());
+    });
+
+    It("Should respect SingleInstance lifetime", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+
+        UObjectContainer* Container = Builder.Build();
+
+        UnrealDI_Impl::FResolveInlineCache Cache;
+        UObject* First = Container->ResolveCached<IReader>(Cache).GetObject();
+
+        TestEqual("Resolved objects", Container->ResolveCached<IReader>(Cache).GetObject(), First);
+        TestEqual("Resolved object from Container", Container->Resolve<IReader>().GetObject(), First);
+    });
+
+    It("Should Resolve from different containers at the same call site", [this]
+    {
+        FObjectContainerBuilder FirstBuilder;
+        FirstBuilder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* FirstContainer = FirstBuilder.Build();
+
+        FObjectContainerBuilder SecondBuilder;
+        SecondBuilder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* SecondContainer = SecondBuilder.Build();
+
+        TestEqual("First container", ResolveCachedSpec::ResolveReader(FirstContainer).GetObject(), FirstContainer->Resolve<IReader>().GetObject());
+        TestEqual("Second container", ResolveCachedSpec::ResolveReader(SecondContainer).GetObject(), SecondContainer->Resolve<IReader>().GetObject());
+        TestEqual("First container again", ResolveCachedSpec::ResolveReader(FirstContainer).GetObject(), FirstContainer->Resolve<IReader>().GetObject());
+    });
+
+    It("Should Resolve from Parent container", [this]
+    {
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* ParentContainer = ParentBuilder.Build();
+
+        UObjectContainer* Container = FObjectContainerBuilder().BuildNested(*ParentContainer);
+
+        TestEqual("Resolved object", ResolveCachedSpec::ResolveReader(Container).GetObject(), ParentContainer->Resolve<IReader>().GetObject());
+        TestEqual("Resolved object from Parent", ResolveCachedSpec::ResolveReader(ParentContainer).GetObject(), ParentContainer->Resolve<IReader>().GetObject());
+    });
+
+    It("Should Resolve after other types were auto registered", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+
+        UObjectContainer* Container = Builder.Build();
+
+        UnrealDI_Impl::FResolveInlineCache Cache;
+        UObject* Expected = Container->ResolveCached<IReader>(Cache).GetObject();
+
+        // auto registers UNeedInterfaceInstance and changes container Generation
+        Container->Resolve<UNeedInterfaceInstance>();
+
+        TestEqual("Resolved object", Container->ResolveCached<IReader>(Cache).GetObject(), Expected);
+    });
+
+    It("Should Resolve auto registered type", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+
+        UObjectContainer* Container = Builder.Build();
+
+        UnrealDI_Impl::FResolveInlineCache Cache;
+        TestNotNull("Resolved object", Container->ResolveCached<UNeedInterfaceInstance>(Cache));
+        TestNotNull("Resolved object from filled cache", Container->ResolveCached<UNeedInterfaceInstance>(Cache));
+    });
+}
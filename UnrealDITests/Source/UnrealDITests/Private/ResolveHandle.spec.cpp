@@ -0,0 +1,100 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#include "DI/ObjectContainer.h"
+#include "DI/ObjectContainerBuilder.h"
+#include "DI/ResolveHandle.h"
+
+#include "MockReader.h"
+#include "MockClasses.h"
+
+BEGIN_DEFINE_SPEC(FResolveHandleSpec, "UnrealDI.ResolveHandle", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FResolveHandleSpec)
+
+void FResolveHandleSpec::Define()
+{
+    It("Should be invalid by default", [this]
+    {
+        TResolveHandle<UMockReader> Handle;
+
+        TestFalse("IsValid", Handle.IsValid());
+    });
+
+    It("Should Resolve UObject", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>();
+
+        UObjectContainer* Container = Builder.Build();
+        TResolveHandle<UMockReader> Handle = Container->GetHandle<UMockReader>();
+
+        static_assert(std::is_same_v<UMockReader*, decltype(Handle.Resolve())>, "Incorrect return type");
+
+        TestTrue("IsValid", Handle.IsValid());
+        TestNotNull("Resolved object", Handle.Resolve());
+    });
+
+    It("Should Resolve Interface", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>();
+
+        UObjectContainer* Container = Builder.Build();
+        TResolveHandle<IReader> Handle = Container->GetHandle<IReader>();
+
+        static_assert(std::is_same_v<TScriptInterface<IReader>, decltype(Handle.Resolve())>, "Incorrect return type");
+
+        TestNotNull("Resolved interface", Handle.Resolve().GetInterface());
+    });
+
+    It("Should respect Transient lifetime", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>();
+
+        UObjectContainer* Container = Builder.Build();
+        TResolveHandle<UMockReader> Handle = Container->GetHandle<UMockReader>();
+
+        TestNotEqual("Resolved objects", Handle.Resolve(), Handle.Resolve());
+    });
+
+    It("Should respect SingleInstance lifetime", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+
+        UObjectContainer* Container = Builder.Build();
+        TResolveHandle<IReader> Handle = Container->GetHandle<IReader>();
+
+        TestEqual("Resolved objects", Handle.Resolve().GetObject(), Handle.Resolve().GetObject());
+        TestEqual("Resolved object from Container", Handle.Resolve().GetObject(), Container->Resolve<IReader>().GetObject());
+    });
+
+    It("Should Resolve from Parent container", [this]
+    {
+        FObjectContainerBuilder ParentBuilder;
+        ParentBuilder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+        UObjectContainer* ParentContainer = ParentBuilder.Build();
+
+        UObjectContainer* Container = FObjectContainerBuilder().BuildNested(*ParentContainer);
+        TResolveHandle<IReader> Handle = Container->GetHandle<IReader>();
+
+        TestEqual("Resolved object", Handle.Resolve().GetObject(), ParentContainer->Resolve<IReader>().GetObject());
+    });
+
+    It("Should Resolve after other types were auto registered", [this]
+    {
+        FObjectContainerBuilder Builder;
+        Builder.RegisterType<UMockReader>().As<IReader>().SingleInstance();
+
+        UObjectContainer* Container = Builder.Build();
+        TResolveHandle<IReader> Handle = Container->GetHandle<IReader>();
+        UObject* Expected = Handle.Resolve().GetObject();
+
+        // auto registers UNeedInterfaceInstance and changes container Generation
+        Container->Resolve<UNeedInterfaceInstance>();
+
+        TestEqual("Resolved object", Handle.Resolve().GetObject(), Expected);
+    });
+}
@@ -185,3 +185,41 @@ public:
 
     UNeedInterfaceInstance* Instance;
 };
+
+/* Receives runtime arguments from TFactory after dependencies are injected */
+UCLASS()
+class UNREALDITESTS_API UNeedRuntimeArguments : public UObject
+{
+    GENERATED_BODY()
+public:
+    void InitDependencies(UMockReader* ReaderConcrete)
+    {
+        Instance = ReaderConcrete;
+    }
+
+    void InitArguments(int32 InValue, const FString& InName)
+    {
+        bWasInjectedBeforeArguments = Instance != nullptr;
+        Value = InValue;
+        Name = InName;
+    }
+
+    UMockReader* Instance = nullptr;
+    bool bWasInjectedBeforeArguments = false;
+    int32 Value = 0;
+    FString Name;
+};
+
+/* Requests factory of UNeedRuntimeArguments */
+UCLASS()
+class UNREALDITESTS_API UNeedRuntimeArgumentsFactory : public UObject
+{
+    GENERATED_BODY()
+public:
+    void InitDependencies(TFactory<UNeedRuntimeArguments, int32, const FString&>&& InFactory)
+    {
+        Factory = MoveTemp(InFactory);
+    }
+
+    TFactory<UNeedRuntimeArguments, int32, const FString&> Factory;
+};
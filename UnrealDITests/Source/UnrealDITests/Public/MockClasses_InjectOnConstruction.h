@@ -6,6 +6,7 @@
 #include "GameFramework/Actor.h"
 #include "Blueprint/UserWidget.h"
 #include "DI/InjectOnConstruction.h"
+#include "DI/IInjector.h"
 #include "DI/IInjectorProvider.h"
 #include "DI/IResolver.h"
 #include "MockClasses_InjectOnConstruction.generated.h"
@@ -30,6 +31,18 @@ public:
     TScriptInterface<IResolver> Resolver;
 };
 
+/* UObject subclass of FInjectOnConstruction that has no InitDependencies */
+UCLASS()
+class UNREALDITESTS_API UInjectObjectWithoutInitDependencies : public UObject, public FInjectOnConstruction
+{
+    GENERATED_BODY()
+public:
+    UInjectObjectWithoutInitDependencies()
+    {
+        TryInitDependencies(this);
+    }
+};
+
 /* AActor subclass of FInjectOnConstruction */
 UCLASS()
 class UNREALDITESTS_API AInjectActor : public AActor, public FInjectOnConstruction
@@ -112,8 +125,73 @@ class UTestInjectorProvider : public UObject, public IInjectorProvider
 {
     GENERATED_BODY()
 public:
-    TScriptInterface<IInjector> GetInjector(UObject* InjectTarget) const override { return Injector; }
+    TScriptInterface<IInjector> GetInjector(UObject* InjectTarget) const override { ++NumGetInjectorCalls; return Injector; }
+    bool IsInjectorStablePerClass() const override { return bStablePerClass; }
 
     UPROPERTY()
     TScriptInterface<IInjector> Injector;
+
+    bool bStablePerClass = false;
+    mutable int32 NumGetInjectorCalls = 0;
+};
+
+/* Injects any object by counting it */
+UCLASS()
+class UTestCountingInjector : public UObject, public IInjector
+{
+    GENERATED_BODY()
+public:
+    bool Inject(UObject* Object) const override { ++NumInjected; return true; }
+    bool CanInject(UClass* Class) const override { return true; }
+
+    mutable int32 NumInjected = 0;
+};
+
+/* UActorComponent injected by ULevelInjectionSubsystem */
+UCLASS()
+class UNREALDITESTS_API ULevelInjectComponent : public UActorComponent
+{
+    GENERATED_BODY()
+public:
+    void InitDependencies(TScriptInterface<IResolver>&& InResolver)
+    {
+        Resolver = MoveTemp(InResolver);
+    }
+
+    UPROPERTY()
+    TScriptInterface<IResolver> Resolver;
+};
+
+/* AActor injected by ULevelInjectionSubsystem */
+UCLASS()
+class UNREALDITESTS_API ALevelInjectActor : public AActor
+{
+    GENERATED_BODY()
+public:
+    ALevelInjectActor()
+    {
+        Component = CreateDefaultSubobject<ULevelInjectComponent>(TEXT("Component"));
+    }
+
+    void InitDependencies(TScriptInterface<IResolver>&& InResolver)
+    {
+        Resolver = MoveTemp(InResolver);
+        ++NumInitDependenciesCalls;
+    }
+
+    UPROPERTY()
+    TScriptInterface<IResolver> Resolver;
+
+    UPROPERTY()
+    TObjectPtr<ULevelInjectComponent> Component;
+
+    bool bInjectedBeforeBeginPlay = false;
+    int32 NumInitDependenciesCalls = 0;
+
+protected:
+    void BeginPlay() override
+    {
+        Super::BeginPlay();
+        bInjectedBeforeBeginPlay = Resolver.GetObject() != nullptr;
+    }
 };